@@ -0,0 +1,420 @@
+#include "include/ArtLibrary.h"
+#include "include/AsciiArt.h"
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+
+#ifdef _WIN32
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+using namespace std;
+
+// -------------------- Index layout --------------------
+// Header | Art[artCount] | LineRecord[lineCount] | Slot[slotCount] | text
+// Offsets only, no pointers, so the same bytes work built in memory or mapped.
+
+static const char INDEX_MAGIC[8] = { 'B', 'F', 'A', 'R', 'T', 'L', 'I', 'B' };
+static const uint32_t INDEX_FORMAT = 1;
+
+struct ArtLibrary::Header {
+    char magic[8];
+    uint32_t format;
+    uint32_t artCount;
+    uint32_t lineCount;
+    uint32_t slotCount;            // power of two, open addressing
+    uint64_t sourceTime;           // BinaryARTS.txt last write time
+    uint64_t sourceSize;
+    uint32_t textBytes;
+    uint32_t reserved[5];
+};
+
+struct ArtLibrary::Art {
+    uint32_t nameOffset;           // lowercase, in the text area
+    uint32_t nameLength;
+    uint32_t firstLine;            // into the line table
+    uint32_t lineCount;
+    uint32_t maxWidth;
+};
+
+struct ArtLibrary::LineRecord {
+    uint32_t offset;               // expanded line, in the text area
+    uint32_t length;
+    uint32_t width;
+};
+
+struct Slot {
+    enum Kind : uint32_t { Empty, Name, Tag };
+
+    uint32_t keyOffset;            // lowercase, in the text area
+    uint32_t keyLength;
+    uint32_t art;
+    uint32_t kind;
+};
+
+static_assert(sizeof(ArtLibrary::Header) == 64, "art index header layout");
+static_assert(sizeof(ArtLibrary::Art) == 20, "art index art layout");
+static_assert(sizeof(ArtLibrary::LineRecord) == 12, "art index line layout");
+static_assert(sizeof(Slot) == 16, "art index slot layout");
+
+static const ArtLibrary::Header* header_of(const char* image) {
+    return reinterpret_cast<const ArtLibrary::Header*>(image);
+}
+
+static const ArtLibrary::Art* arts_of(const char* image) {
+    return reinterpret_cast<const ArtLibrary::Art*>(image + sizeof(ArtLibrary::Header));
+}
+
+static const ArtLibrary::LineRecord* lines_of(const char* image) {
+    return reinterpret_cast<const ArtLibrary::LineRecord*>(arts_of(image) + header_of(image)->artCount);
+}
+
+static const Slot* slots_of(const char* image) {
+    return reinterpret_cast<const Slot*>(lines_of(image) + header_of(image)->lineCount);
+}
+
+static const char* text_of(const char* image) {
+    return reinterpret_cast<const char*>(slots_of(image) + header_of(image)->slotCount);
+}
+
+static size_t image_size(uint32_t arts, uint32_t lines, uint32_t slots, uint32_t textBytes) {
+    return sizeof(ArtLibrary::Header) + arts * sizeof(ArtLibrary::Art) +
+        lines * sizeof(ArtLibrary::LineRecord) + slots * sizeof(Slot) + textBytes;
+}
+
+// -------------------- Keys --------------------
+// FNV-1a over the kind and the lowercased key, so "Windows" finds "windows"
+
+static char lower(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+static uint64_t hash_key(uint32_t kind, const char* key, size_t length) {
+    uint64_t h = 14695981039346656037ULL;
+    h ^= kind;
+    h *= 1099511628211ULL;
+    for (size_t i = 0; i < length; ++i) {
+        h ^= static_cast<unsigned char>(lower(key[i]));
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static bool key_equals(const char* stored, size_t storedLength, const char* key, size_t length) {
+    if (storedLength != length) return false;
+    for (size_t i = 0; i < length; ++i) {
+        if (stored[i] != lower(key[i])) return false;
+    }
+    return true;
+}
+
+// -------------------- Construction --------------------
+
+ArtLibrary::ArtLibrary() : image(nullptr) {}
+
+bool ArtLibrary::open(const string& textPath, bool reuse) {
+    size_t dot = textPath.find_last_of('.');
+    size_t slash = textPath.find_last_of("\\/");
+    bool hasExtension = dot != string::npos && (slash == string::npos || dot > slash);
+    indexPath = (hasExtension ? textPath.substr(0, dot) : textPath) + ".idx";
+    image = nullptr;
+    owned.clear();
+    index.close();
+
+    // stamp the text before reading it: an edit made after this point
+    // gets a newer time and is picked up by the next run
+    unsigned long long time = 0, size = 0;
+    if (!MappedFile::stamp(textPath, time, size)) return false;
+
+    if (reuse && index.open(indexPath)) {
+        if (validate(index.data(), index.size()) &&
+            header_of(index.data())->sourceTime == time && header_of(index.data())->sourceSize == size) {
+            image = index.data();
+            return true;
+        }
+        index.close();
+    }
+
+    ifstream in(textPath, ios::binary);
+    if (!in.is_open()) return false;
+    string text((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    in.close();
+
+    build(text, time, size);
+    MappedFile::replace(indexPath, owned.data(), owned.size());   // next run maps it
+    return this->size() > 0;
+}
+
+// -------------------- Build --------------------
+
+void ArtLibrary::build(const string& source, unsigned long long time, unsigned long long size) {
+    struct Pending {
+        string name;
+        vector<string> tags;
+    };
+    vector<Art> arts;
+    vector<LineRecord> lines;
+    vector<pair<uint32_t, uint32_t>> keys;     // (kind, art) per entry of keyText
+    vector<string> keyText;
+    string text;
+
+    Pending pending;
+    bool open = false;             // the last art still takes lines
+    auto lowercase = [](string s) {
+        for (char& c : s) c = lower(c);
+        return s;
+    };
+
+    size_t pos = 0;
+    if (source.compare(0, 3, "\xEF\xBB\xBF") == 0) pos = 3;
+    while (pos < source.size()) {
+        size_t end = source.find('\n', pos);
+        if (end == string::npos) end = source.size();
+        string line = source.substr(pos, end - pos);
+        pos = end + 1;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        if (line.empty()) {
+            open = false;
+            continue;
+        }
+        if (line.compare(0, 4, "@art") == 0 && (line.size() == 4 || line[4] == ' ' || line[4] == '\t')) {
+            // "@art name tag tag...": names the next art
+            open = false;
+            pending = Pending();
+            size_t w = 4;
+            while (w < line.size()) {
+                size_t start = line.find_first_not_of(" \t", w);
+                if (start == string::npos) break;
+                w = line.find_first_of(" \t", start);
+                if (w == string::npos) w = line.size();
+                string word = lowercase(line.substr(start, w - start));
+                if (pending.name.empty()) pending.name = word;
+                else pending.tags.push_back(word);
+            }
+            continue;
+        }
+
+        if (!open) {
+            Art a = {};
+            a.firstLine = static_cast<uint32_t>(lines.size());
+            uint32_t n = static_cast<uint32_t>(arts.size());
+            if (!pending.name.empty()) {
+                a.nameOffset = static_cast<uint32_t>(text.size());
+                a.nameLength = static_cast<uint32_t>(pending.name.size());
+                text += pending.name;
+                keyText.push_back(pending.name);
+                keys.push_back({ Slot::Name, n });
+            }
+            for (const string& tag : pending.tags) {
+                keyText.push_back(tag);
+                keys.push_back({ Slot::Tag, n });
+            }
+            pending = Pending();
+            arts.push_back(a);
+            open = true;
+        }
+
+        string expanded = processColorCodes(line);
+        LineRecord r;
+        r.offset = static_cast<uint32_t>(text.size());
+        r.length = static_cast<uint32_t>(expanded.size());
+        r.width = static_cast<uint32_t>(visible_width(expanded));
+        text += expanded;
+        lines.push_back(r);
+        arts.back().lineCount++;
+        if (r.width > arts.back().maxWidth) arts.back().maxWidth = r.width;
+    }
+
+    // names and tags: load factor <= 1/2, the first art with a key keeps it
+    uint32_t slotCount = 16;
+    while (slotCount < keys.size() * 2) slotCount *= 2;
+    vector<Slot> slots(slotCount, Slot{ 0, 0, 0, Slot::Empty });
+    for (size_t k = 0; k < keys.size(); ++k) {
+        const string& key = keyText[k];
+        size_t i = hash_key(keys[k].first, key.data(), key.size()) & (slotCount - 1);
+        bool taken = false;
+        while (slots[i].kind != Slot::Empty) {
+            if (slots[i].kind == keys[k].first &&
+                key_equals(text.data() + slots[i].keyOffset, slots[i].keyLength, key.data(), key.size())) {
+                taken = true;
+                break;
+            }
+            i = (i + 1) & (slotCount - 1);
+        }
+        if (taken) continue;
+        slots[i].keyOffset = static_cast<uint32_t>(text.size());
+        slots[i].keyLength = static_cast<uint32_t>(key.size());
+        slots[i].art = keys[k].second;
+        slots[i].kind = keys[k].first;
+        text += key;
+    }
+
+    Header h = {};
+    memcpy(h.magic, INDEX_MAGIC, sizeof(h.magic));
+    h.format = INDEX_FORMAT;
+    h.artCount = static_cast<uint32_t>(arts.size());
+    h.lineCount = static_cast<uint32_t>(lines.size());
+    h.slotCount = slotCount;
+    h.sourceTime = time;
+    h.sourceSize = size;
+    h.textBytes = static_cast<uint32_t>(text.size());
+
+    owned.assign(image_size(h.artCount, h.lineCount, h.slotCount, h.textBytes), 0);
+    char* out = owned.data();
+    memcpy(out, &h, sizeof(h));
+    out += sizeof(h);
+    if (!arts.empty()) memcpy(out, arts.data(), arts.size() * sizeof(Art));
+    out += arts.size() * sizeof(Art);
+    if (!lines.empty()) memcpy(out, lines.data(), lines.size() * sizeof(LineRecord));
+    out += lines.size() * sizeof(LineRecord);
+    memcpy(out, slots.data(), slots.size() * sizeof(Slot));
+    out += slots.size() * sizeof(Slot);
+    if (!text.empty()) memcpy(out, text.data(), text.size());
+    image = owned.data();
+}
+
+// Header only: every record is bounds-checked when it is read, so opening
+// costs the same for 5 arts or 5000 and untouched pages stay on disk
+bool ArtLibrary::validate(const char* data, size_t size) const {
+    if (size < sizeof(Header)) return false;
+    const Header* h = header_of(data);
+    if (memcmp(h->magic, INDEX_MAGIC, sizeof(h->magic)) != 0) return false;
+    if (h->format != INDEX_FORMAT) return false;
+    if (h->slotCount < 16 || (h->slotCount & (h->slotCount - 1)) != 0) return false;
+    return image_size(h->artCount, h->lineCount, h->slotCount, h->textBytes) == size;
+}
+
+// -------------------- Lookups --------------------
+
+const ArtLibrary::Art* ArtLibrary::art(int n) const {
+    if (!image || n < 0 || static_cast<uint32_t>(n) >= header_of(image)->artCount) return nullptr;
+    const Header* h = header_of(image);
+    const Art* a = &arts_of(image)[n];
+    if (a->firstLine > h->lineCount || a->lineCount > h->lineCount - a->firstLine) return nullptr;
+    if (a->nameOffset > h->textBytes || a->nameLength > h->textBytes - a->nameOffset) return nullptr;
+    return a;
+}
+
+int ArtLibrary::lookup(unsigned kind, const char* key, size_t length) const {
+    if (!image) return -1;
+    const Header* h = header_of(image);
+    const Slot* slots = slots_of(image);
+    const char* text = text_of(image);
+    uint32_t mask = h->slotCount - 1;
+    uint32_t i = static_cast<uint32_t>(hash_key(kind, key, length)) & mask;
+    for (uint32_t probes = 0; probes < h->slotCount; ++probes, i = (i + 1) & mask) {
+        const Slot& s = slots[i];
+        if (s.kind == Slot::Empty) return -1;
+        if (s.kind != kind) continue;
+        if (s.keyOffset > h->textBytes || s.keyLength > h->textBytes - s.keyOffset) return -1;
+        if (key_equals(text + s.keyOffset, s.keyLength, key, length)) {
+            return s.art < h->artCount ? static_cast<int>(s.art) : -1;
+        }
+    }
+    return -1;
+}
+
+int ArtLibrary::find(const string& key) const {
+    if (key.empty()) return -1;
+    int n = lookup(Slot::Name, key.data(), key.size());
+    if (n < 0) n = lookup(Slot::Tag, key.data(), key.size());
+    if (n >= 0) return n;
+
+    // "3" = third art of the file
+    if (key.size() > 6 || key.find_first_not_of("0123456789") != string::npos) return -1;
+    int number = stoi(key);
+    return (number >= 1 && static_cast<size_t>(number) <= size()) ? number - 1 : -1;
+}
+
+int ArtLibrary::findForSystem() const {
+    for (const string& tag : systemTags()) {
+        int n = lookup(Slot::Tag, tag.data(), tag.size());
+        if (n >= 0) return n;
+    }
+    return -1;
+}
+
+size_t ArtLibrary::size() const {
+    return image ? header_of(image)->artCount : 0;
+}
+
+string ArtLibrary::name(int n) const {
+    const Art* a = art(n);
+    return a ? string(text_of(image) + a->nameOffset, a->nameLength) : string();
+}
+
+int ArtLibrary::height(int n) const {
+    const Art* a = art(n);
+    return a ? static_cast<int>(a->lineCount) : 0;
+}
+
+int ArtLibrary::maxWidth(int n) const {
+    const Art* a = art(n);
+    return a ? static_cast<int>(a->maxWidth) : 0;
+}
+
+ArtLibrary::Line ArtLibrary::line(int n, int i) const {
+    Line empty = { "", 0, 0 };
+    const Art* a = art(n);
+    if (!a || i < 0 || static_cast<uint32_t>(i) >= a->lineCount) return empty;
+    const LineRecord& r = lines_of(image)[a->firstLine + i];
+    const uint32_t textBytes = header_of(image)->textBytes;
+    if (r.offset > textBytes || r.length > textBytes - r.offset) return empty;
+    Line l = { text_of(image) + r.offset, r.length, static_cast<int>(r.width) };
+    return l;
+}
+
+// -------------------- System tags --------------------
+
+static string cpu_vendor() {
+    char vendor[13] = { 0 };
+#ifdef _WIN32
+    int regs[4] = { 0 };
+    __cpuid(regs, 0);
+    memcpy(vendor, &regs[1], 4);      // EBX EDX ECX
+    memcpy(vendor + 4, &regs[3], 4);
+    memcpy(vendor + 8, &regs[2], 4);
+#elif defined(__x86_64__) || defined(__i386__)
+    unsigned int a, b, c, d;
+    if (!__get_cpuid(0, &a, &b, &c, &d)) return "";
+    memcpy(vendor, &b, 4);
+    memcpy(vendor + 4, &d, 4);
+    memcpy(vendor + 8, &c, 4);
+#endif
+    if (strcmp(vendor, "GenuineIntel") == 0) return "intel";
+    if (strcmp(vendor, "AuthenticAMD") == 0) return "amd";
+    return "";
+}
+
+vector<string> ArtLibrary::systemTags() {
+    vector<string> tags;
+#ifdef _WIN32
+    tags.push_back("windows");
+#else
+    // ID=ubuntu, ID_LIKE="debian": the distro, then what it derives from
+    ifstream release("/etc/os-release");
+    string line, id, like;
+    while (getline(release, line)) {
+        if (line.compare(0, 3, "ID=") == 0) id = line.substr(3);
+        else if (line.compare(0, 8, "ID_LIKE=") == 0) like = line.substr(8);
+    }
+    string word;
+    for (char c : id + " " + like + " ") {
+        if (c == '"' || c == '\'' || c == '\r') continue;
+        if (c == ' ') {
+            if (!word.empty()) tags.push_back(word);
+            word.clear();
+        }
+        else {
+            word += lower(c);
+        }
+    }
+    tags.push_back("linux");
+#endif
+    string vendor = cpu_vendor();
+    if (!vendor.empty()) tags.push_back(vendor);
+    return tags;
+}
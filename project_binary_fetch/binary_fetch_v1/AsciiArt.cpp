@@ -1,14 +1,11 @@
 ﻿// AsciiArt.cpp
-#include "include\AsciiArt.h"
-#include "include\resource.h" // Essential for IDR_DEFAULT_ASCII
+#include "include/AsciiArt.h"
+#include "include/resource.h" // Essential for IDR_DEFAULT_ASCII
+#include "include/TextWidth.h"
+#include "include/ArtLibrary.h"
 #include <iostream>
 #include <fstream>
-#include <regex>
-#include <locale>
-#include <codecvt>
-#include <cwchar>
 #include <sstream>
-#include <map>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -18,73 +15,73 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <pwd.h>
+#include <cerrno>
 #endif
 
 // ---------------- Color Map (Cyan & White Theme) ----------------
-static const std::map<int, std::string> colorMap = {
-    {1, "\033[31m"}, {2, "\033[32m"}, {3, "\033[33m"},
-    {4, "\033[34m"}, {5, "\033[35m"}, {6, "\033[36m"}, // Cyan
-    {7, "\033[37m"}, {8, "\033[91m"}, {9, "\033[92m"},
-    {10, "\033[93m"}, {11, "\033[94m"}, {12, "\033[95m"},
-    {13, "\033[96m"}, {14, "\033[97m"}, {15, "\033[0m"}
+// $n -> escape code, indexed by n (0 is not a color)
+static const char* const colorMap[] = {
+    nullptr,
+    "\033[31m", "\033[32m", "\033[33m",
+    "\033[34m", "\033[35m", "\033[36m", // Cyan
+    "\033[37m", "\033[91m", "\033[92m",
+    "\033[93m", "\033[94m", "\033[95m",
+    "\033[96m", "\033[97m", "\033[0m"
 };
+static const int colorCount = static_cast<int>(sizeof(colorMap) / sizeof(colorMap[0]));
+
+static bool isDigit(char c) { return c >= '0' && c <= '9'; }
 
 // ---------------- Utility Functions ----------------
 
+// Drops "ESC [ digits/semicolons letter"; anything else (a lone ESC too) is kept
 std::string stripAnsiSequences(const std::string& s) {
-    static const std::regex ansi_re("\x1B\\[[0-9;]*[A-Za-z]");
-    return std::regex_replace(s, ansi_re, "");
+    std::string out;
+    out.reserve(s.size());
+
+    const size_t n = s.size();
+    size_t i = 0;
+    while (i < n) {
+        if (s[i] == '\x1B' && i + 1 < n && s[i + 1] == '[') {
+            size_t j = i + 2;
+            while (j < n && (isDigit(s[j]) || s[j] == ';')) ++j;
+            if (j < n && ((s[j] >= 'A' && s[j] <= 'Z') || (s[j] >= 'a' && s[j] <= 'z'))) {
+                i = j + 1;
+                continue;
+            }
+        }
+        out += s[i++];
+    }
+    return out;
 }
 
+// "$<digits>" becomes the color, unknown numbers just disappear,
+// and every line ends with a reset
 std::string processColorCodes(const std::string& line) {
-    std::string result = line;
-    std::regex colorCodeRegex("\\$(\\d+)");
-    std::smatch match;
     std::string processed;
-    std::string remaining = result;
-
-    while (std::regex_search(remaining, match, colorCodeRegex)) {
-        processed += match.prefix();
-        int colorNum = std::stoi(match[1].str());
-        auto it = colorMap.find(colorNum);
-        if (it != colorMap.end()) processed += it->second;
-        remaining = match.suffix();
+    processed.reserve(line.size() * 5 / 2 + 4);   // worst case "$1$1..." (2 bytes -> 5), no regrowth
+
+    const size_t n = line.size();
+    size_t i = 0;
+    while (i < n) {
+        size_t start = i;
+        while (i < n && !(line[i] == '$' && i + 1 < n && isDigit(line[i + 1]))) ++i;
+        processed.append(line, start, i - start);
+        if (i >= n) break;
+
+        int colorNum = 0;
+        for (++i; i < n && isDigit(line[i]); ++i) {
+            if (colorNum < colorCount) colorNum = colorNum * 10 + (line[i] - '0');   // saturates, never overflows
+        }
+        if (colorNum > 0 && colorNum < colorCount) processed += colorMap[colorNum];
     }
-    processed += remaining + "\033[0m";
+    processed += "\033[0m";
     return processed;
 }
 
-std::wstring utf8_to_wstring(const std::string& s) {
-    try {
-        std::wstring_convert<std::codecvt_utf8<wchar_t>> conv;
-        return conv.from_bytes(s);
-    }
-    catch (...) {
-        std::wstring w;
-        for (unsigned char c : s) w.push_back(static_cast<wchar_t>(c));
-        return w;
-    }
-}
-
-int char_display_width(wchar_t wc) {
-#if !defined(_WIN32)
-    int w = wcwidth(wc);
-    return (w < 0) ? 0 : w;
-#else
-    if (wc == 0) return 0;
-    if (wc < 0x1100) return 1;
-    if ((wc >= 0x1100 && wc <= 0x115F) || (wc >= 0x2E80 && wc <= 0xA4CF) ||
-        (wc >= 0xAC00 && wc <= 0xD7A3) || (wc >= 0xFF00 && wc <= 0xFF60)) return 2;
-    return 1;
-#endif
-}
-
+// one pass, escapes skipped inline, no copies (TextWidth.cpp)
 size_t visible_width(const std::string& s) {
-    const std::string cleaned = stripAnsiSequences(s);
-    const std::wstring w = utf8_to_wstring(cleaned);
-    size_t width = 0;
-    for (wchar_t wc : w) width += static_cast<size_t>(char_display_width(wc));
-    return width;
+    return utf8_display_width(s);
 }
 
 void sanitizeLeadingInvisible(std::string& s) {
@@ -182,39 +179,278 @@ bool AsciiArt::loadFromFile() {
     return loadArtFromPath(userArtPath);
 }
 
+bool AsciiArt::loadFromLibrary(const ArtLibrary& library, int art) {
+    int lines = library.height(art);
+    if (lines == 0) return false;
+
+    artLines.clear();
+    artWidths.clear();
+    artLines.reserve(lines);
+    artWidths.reserve(lines);
+    for (int i = 0; i < lines; ++i) {
+        ArtLibrary::Line line = library.line(art, i);
+        artLines.emplace_back(line.data, line.size);
+        artWidths.push_back(line.width);
+    }
+    maxWidth = library.maxWidth(art);
+    height = lines;
+    enabled = true;
+    return true;
+}
+
 // ---------------- LivePrinter ----------------
 
-LivePrinter::LivePrinter(const AsciiArt& artRef) : art(artRef), index(0) {}
+// Whole buffer to stdout, retrying partial writes. Returns false if the raw
+// handle can't be used (the caller falls back to std::cout).
+static bool writeStdout(const char* data, size_t size) {
+#ifdef _WIN32
+    HANDLE out = GetStdHandle(STD_OUTPUT_HANDLE);
+    if (out == NULL || out == INVALID_HANDLE_VALUE) return false;
+    while (size > 0) {
+        DWORD chunk = size > 0x40000000 ? 0x40000000 : static_cast<DWORD>(size);
+        DWORD written = 0;
+        if (!WriteFile(out, data, chunk, &written, NULL) || written == 0) return false;
+        data += written;
+        size -= written;
+    }
+#else
+    while (size > 0) {
+        ssize_t written = write(STDOUT_FILENO, data, size);
+        if (written < 0 && errno == EINTR) continue;
+        if (written <= 0) return false;
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+#endif
+    return true;
+}
 
-void LivePrinter::push(const std::string& infoLine) {
+LivePrinter::LivePrinter(const AsciiArt& artRef, Mode mode, size_t flushBytes)
+    : art(artRef), index(0), mode(mode), flushBytes(flushBytes), writes(0), bytes(0), keep(false) {
+    frame.reserve(flushBytes > 0 ? flushBytes + 1024 : 16384);
+}
+
+void LivePrinter::appendLine(const std::string& infoLine) {
+    if (keep) shown.push_back(infoLine);
     printArtAndPad();
-    if (!infoLine.empty()) std::cout << infoLine;
-    std::cout << '\n';
+    frame += infoLine;
+    frame += '\n';
     index++;
 }
 
+void LivePrinter::push(const std::string& infoLine) {
+    appendLine(infoLine);
+    if (mode == Mode::Live || (flushBytes > 0 && frame.size() >= flushBytes)) flush();
+}
+
+void LivePrinter::push(const std::vector<std::string>& infoLines) {
+    for (const auto& line : infoLines) {
+        appendLine(line);
+        if (mode == Mode::Buffered && flushBytes > 0 && frame.size() >= flushBytes) flush();
+    }
+    if (mode == Mode::Live) flush();
+}
+
 void LivePrinter::printArtAndPad() {
     int artH = art.getHeight();
     int maxW = art.getMaxWidth();
     int spacing = art.getSpacing();
 
+    // padding is appended in place, no temporary strings
     if (index < artH) {
-        std::cout << art.getLine(index);
+        frame += art.getLine(index);
         int curW = art.getLineWidth(index);
-        if (curW < maxW) std::cout << std::string(maxW - curW, ' ');
+        if (curW < maxW) frame.append(static_cast<size_t>(maxW - curW), ' ');
     }
     else if (maxW > 0) {
-        std::cout << std::string(maxW, ' ');
+        frame.append(static_cast<size_t>(maxW), ' ');
     }
-    if (spacing > 0) std::cout << std::string(spacing, ' ');
+    if (spacing > 0) frame.append(static_cast<size_t>(spacing), ' ');
 }
 
 void LivePrinter::finish() {
     while (index < art.getHeight()) {
         printArtAndPad();
-        std::cout << '\n';
+        frame += '\n';
         index++;
     }
+    flush();
+}
+
+void LivePrinter::flush() {
+    if (frame.empty()) return;
+
+    // anything main() printed through cout must land before this frame
+    std::cout.flush();
+    if (!writeStdout(frame.data(), frame.size())) {
+        std::cout.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+        std::cout.flush();
+    }
+    writes++;
+    bytes += frame.size();
+    frame.clear();   // keeps its capacity for the next lines
+}
+
+// ---------------- Watch repaint ----------------
+
+namespace {
+// One screen cell of an info line: a glyph (with any zero width marks
+// after it) and the escape sequences in effect where it starts
+struct Cell {
+    size_t start;
+    size_t size;
+    int column;
+    int width;
+    unsigned long long style;
+};
+}
+
+static const unsigned long long STYLE_NONE = 14695981039346656037ULL;
+
+static bool sameCell(const std::string& a, const Cell& x, const std::string& b, const Cell& y) {
+    return x.column == y.column && x.width == y.width && x.style == y.style &&
+        x.size == y.size && a.compare(x.start, x.size, b, y.start, y.size) == 0;
+}
+
+// Escapes only change the style, so "\033[0m" / "\033[m" start it over
+static void splitCells(const std::string& s, std::vector<Cell>& cells) {
+    cells.clear();
+    unsigned long long style = STYLE_NONE;
+    int column = 0;
+    const size_t n = s.size();
+    size_t i = 0;
+    while (i < n) {
+        unsigned char c = static_cast<unsigned char>(s[i]);
+        if (c == 0x1B && i + 1 < n && s[i + 1] == '[') {
+            size_t j = i + 2;
+            while (j < n && !(s[j] >= 0x40 && s[j] <= 0x7E)) ++j;
+            if (j < n) ++j;
+            bool reset = (j - i == 3 || (j - i == 4 && s[i + 2] == '0')) && s[j - 1] == 'm';
+            if (reset) {
+                style = STYLE_NONE;
+            }
+            else {
+                for (size_t k = i; k < j; ++k) {
+                    style ^= static_cast<unsigned char>(s[k]);
+                    style *= 1099511628211ULL;
+                }
+            }
+            i = j;
+            continue;
+        }
+
+        size_t len = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : (c >> 3) == 0x1E ? 4 : 1;
+        if (i + len > n) len = 1;
+        char32_t cp = len == 1 ? c : static_cast<char32_t>(c & (0x7F >> len));
+        for (size_t k = 1; k < len; ++k) cp = (cp << 6) | (static_cast<unsigned char>(s[i + k]) & 0x3F);
+        int width = codepoint_width(cp);
+
+        if (width == 0) {
+            if (!cells.empty()) cells.back().size = i + len - cells.back().start;
+        }
+        else {
+            cells.push_back({ i, len, column, width, style });
+            column += width;
+        }
+        i += len;
+    }
+}
+
+void LivePrinter::keepFrame() {
+    keep = true;
+}
+
+size_t LivePrinter::repaint(const std::vector<std::string>& infoLines, int screenRows) {
+    const int artH = art.getHeight();
+    const int infoColumn = art.getMaxWidth() + art.getSpacing();
+    const int oldRows = index;
+    const int newLines = static_cast<int>(infoLines.size());
+    const int newRows = newLines > artH ? newLines : artH;
+    const int firstVisible = screenRows > 0 ? oldRows - (screenRows - 1) : 0;
+
+    int cursor = oldRows;      // row the cursor is on, column 0
+    size_t painted = 0;
+    auto moveTo = [&](int row, int column) {
+        if (row < cursor) frame += "\033[" + std::to_string(cursor - row) + "A";
+        if (row > cursor) frame += "\033[" + std::to_string(row - cursor) + "B";
+        frame += '\r';
+        if (column > 0) frame += "\033[" + std::to_string(column) + "C";
+        cursor = row;
+    };
+
+    static const std::string empty;
+    std::vector<Cell> before, after;
+    const int onScreen = oldRows < newRows ? oldRows : newRows;
+    for (int row = firstVisible > 0 ? firstVisible : 0; row < onScreen; ++row) {
+        const std::string& was = row < static_cast<int>(shown.size()) ? shown[row] : empty;
+        const std::string& now = row < newLines ? infoLines[row] : empty;
+        if (was == now) continue;
+
+        splitCells(was, before);
+        splitCells(now, after);
+        size_t first = 0;
+        while (first < before.size() && first < after.size() && sameCell(was, before[first], now, after[first])) ++first;
+
+        // a common tail only lines up if both end in the same column
+        size_t endBefore = before.size(), endAfter = after.size();
+        int widthBefore = before.empty() ? 0 : before.back().column + before.back().width;
+        int widthAfter = after.empty() ? 0 : after.back().column + after.back().width;
+        if (widthBefore == widthAfter) {
+            while (endBefore > first && endAfter > first &&
+                sameCell(was, before[endBefore - 1], now, after[endAfter - 1])) {
+                --endBefore;
+                --endAfter;
+            }
+        }
+        if (first == endAfter && widthAfter >= widthBefore) continue;
+
+        int column = first < after.size() ? after[first].column : widthAfter;
+        moveTo(row, infoColumn + column);
+        if (first < endAfter) {
+            // re-establish the style of the first cell, then the cells (and
+            // any escapes between them) straight from the new line
+            size_t start = after[first].start;
+            frame += "\033[0m";
+            for (size_t k = 0; k < start; ++k) {
+                if (now[k] != '\x1B') continue;
+                size_t j = k + 2;
+                while (j < start && !(now[j] >= 0x40 && now[j] <= 0x7E)) ++j;
+                frame.append(now, k, j + 1 - k);
+                k = j;
+            }
+            size_t end = after[endAfter - 1].start + after[endAfter - 1].size;
+            frame.append(now, start, end - start);
+            frame += "\033[0m";
+            painted += endAfter - first;
+        }
+        if (widthAfter < widthBefore && endAfter == after.size()) frame += "\033[K";
+    }
+
+    if (newRows > oldRows) {
+        // new rows at the bottom scroll in like a normal push
+        moveTo(oldRows, 0);
+        for (int row = oldRows; row < newRows; ++row) {
+            index = row;
+            printArtAndPad();
+            if (row < newLines) {
+                frame += infoLines[row];
+                painted += utf8_display_width(infoLines[row]);
+            }
+            frame += '\n';
+        }
+        cursor = newRows;
+    }
+    else if (newRows < oldRows) {
+        moveTo(newRows, 0);
+        frame += "\033[J";
+    }
+    moveTo(newRows, 0);
+
+    index = newRows;
+    shown = infoLines;
+    if (frame == "\r") frame.clear();   // nothing changed
+    flush();
+    return painted;
 }
 /*
 Color Code Feature:
@@ -562,6 +798,8 @@ void AsciiArt::clear() {
 }
 
 // ---------------- LivePrinter implementation ----------------
+// (v1: one std::cout << per line. Replaced by the frame buffer, see the
+// LivePrinter section at the top of this file.)
 
 LivePrinter::LivePrinter(const AsciiArt& artRef) : art(artRef), index(0) {}
 
@@ -680,16 +918,34 @@ PRIVATE HELPERS:
 ------------------------------------------------
 CLASS: LivePrinter
 OBJECT: N/A (used in main.cpp as 'lp')
-DESCRIPTION: Streams system info lines alongside ASCII art.
+DESCRIPTION: Puts system info lines next to the ASCII art. Art line, padding
+    and info line are appended to one frame buffer (std::string, reused);
+    flush() hands it to stdout in a single write() / WriteFile, falling back
+    to std::cout if the raw handle can't be used.
+MODES (config "output.mode", --live / --buffered):
+    Live       default. Every push() is flushed right away, a vector push()
+               in one write, so sections show up as soon as they are ready.
+    Buffered   the frame is written once, in finish(). If "output.flush_bytes"
+               is > 0 it is also flushed whenever it grows past that size
+               (0 = only in finish()).
 FUNCTIONS:
-    LivePrinter(const AsciiArt& artRef) -> constructor
-        Initialize LivePrinter with a reference to AsciiArt.
+    LivePrinter(const AsciiArt& artRef, Mode mode = Mode::Live, size_t flushBytes = 0) -> constructor
+        Initialize LivePrinter with a reference to AsciiArt, the mode and
+        output.flush_bytes.
     void push(const std::string& infoLine) -> void
-        Print a line with ASCII art padding.
-    void pushBlank() -> void
-        Print a blank line with ASCII art padding.
+        Append a line with ASCII art padding; flushed as described above.
+    void push(const std::vector<std::string>& infoLines) -> void
+        Append several lines; in Live mode they go out in one write.
     void finish() -> void
-        Print remaining ASCII art lines if any.
+        Append remaining ASCII art lines if any, then flush.
+    void flush() -> void
+        Write everything composed so far (no-op if nothing is pending).
+    void keepFrame() -> void
+        Watch mode: remember each row's info line (call before the first push).
+    size_t repaint(const std::vector<std::string>& infoLines, int screenRows) -> size_t
+        After finish(): rewrite only the changed cells, in one write.
+    size_t writeCount() const / size_t bytesWritten() const
+        Writes and bytes that reached the terminal (for --stats).
 ------------------------------------------------
 HELPER FUNCTIONS:
     std::string stripAnsiSequences(const std::string& s) -> std::string
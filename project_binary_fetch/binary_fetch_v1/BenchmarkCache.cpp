@@ -0,0 +1,192 @@
+#include "include/BenchmarkCache.h"
+#include "nlohmann/json.hpp"
+#include <fstream>
+#include <ctime>
+#include <cstdio>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace std;
+using json = nlohmann::json;
+
+static const int CACHE_FORMAT = 1;
+
+struct BenchmarkCache::State {
+    json entries = json::object();
+};
+
+// -------------------- Report <-> JSON --------------------
+
+static json to_json(const BenchmarkResult& r) {
+    return { { "mbps", r.mbps }, { "iops", r.iops }, { "p50_us", r.p50Us },
+             { "p99_us", r.p99Us }, { "p999_us", r.p999Us }, { "ops", r.ops } };
+}
+
+// absent / malformed = a test that didn't run
+static BenchmarkResult result_from(const json& j, const char* key) {
+    BenchmarkResult r;
+    if (!j.contains(key) || !j[key].is_object()) return r;
+    const json& v = j[key];
+    r.mbps = v.value("mbps", 0.0);
+    r.iops = v.value("iops", 0.0);
+    r.p50Us = v.value("p50_us", 0.0);
+    r.p99Us = v.value("p99_us", 0.0);
+    r.p999Us = v.value("p999_us", 0.0);
+    r.ops = v.value("ops", 0ULL);
+    r.ok = r.ops > 0;
+    return r;
+}
+
+// what a disk result depends on besides the disk: "w0 qd32 250+50ms 64MB".
+// An entry measured with other settings (read only, where the write test is
+// now on...) doesn't count
+static string options_key(const BenchmarkOptions& o) {
+    string key = string(o.write ? "w1" : "w0") + " qd" + to_string(o.queueDepth) + " " +
+        to_string(o.durationMs) + "+" + to_string(o.warmupMs) + "ms " + to_string(o.fileMb) + "MB";
+    if (o.write) key += " budget " + to_string(o.writeBudgetMb) + "MB";
+    return key;
+}
+
+// -------------------- Load / Save --------------------
+BenchmarkCache& BenchmarkCache::instance() {
+    static BenchmarkCache cache;
+    return cache;
+}
+
+BenchmarkCache::BenchmarkCache() : state(new State()), reuse(false), maxAge(0), dirty(false) {
+}
+
+BenchmarkCache::~BenchmarkCache() {
+    delete state;
+}
+
+void BenchmarkCache::load(const string& directory, bool reuseEntries, long long maxAgeSeconds) {
+    lock_guard<mutex> lock(m);
+#ifdef _WIN32
+    path = directory + "\\BinaryFetch_Bench.json";
+#else
+    path = directory + "/BinaryFetch_Bench.json";
+#endif
+    reuse = reuseEntries;
+    maxAge = maxAgeSeconds;
+    state->entries = json::object();
+
+    // read even when not reusing: save() keeps the other devices' entries
+    ifstream in(path);
+    if (!in.is_open()) return;
+
+    try {
+        json file = json::parse(in);
+        if (file.value("format", 0) != CACHE_FORMAT) return;
+        if (file.contains("entries") && file["entries"].is_object()) state->entries = file["entries"];
+    }
+    catch (...) {
+        // unreadable file = nothing cached, it is rewritten by save()
+    }
+}
+
+void BenchmarkCache::save() {
+    lock_guard<mutex> lock(m);
+    if (path.empty() || !dirty) return;
+
+    json file;
+    file["format"] = CACHE_FORMAT;
+    file["entries"] = state->entries;
+
+    // write aside and swap in, so a concurrent run never reads half a file
+    string temp = path + ".tmp";
+    {
+        ofstream out(temp, ios::binary | ios::trunc);
+        if (!out.is_open()) return;
+        out << file.dump(2);
+        if (!out.good()) return;
+    }
+#ifdef _WIN32
+    if (!MoveFileExA(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+        DeleteFileA(temp.c_str());
+        return;
+    }
+#else
+    if (rename(temp.c_str(), path.c_str()) != 0) {
+        remove(temp.c_str());
+        return;
+    }
+#endif
+    dirty = false;
+}
+
+// -------------------- Lookups --------------------
+// The callers are the storage / network collector threads, hence the lock.
+
+bool BenchmarkCache::disk(const string& id, const BenchmarkOptions& options, DiskBenchmarkReport& report, long long& age) {
+    lock_guard<mutex> lock(m);
+    if (!reuse || id.empty()) return false;
+    auto it = state->entries.find("disk:" + id);
+    if (it == state->entries.end() || !it->is_object()) return false;
+    if (it->value("options", "") != options_key(options)) return false;
+
+    long long measured = it->value("time", 0LL);
+    age = static_cast<long long>(time(nullptr)) - measured;
+    if (measured <= 0 || age < 0 || age > maxAge) return false;
+
+    DiskBenchmarkReport cached;
+    cached.engine = it->value("engine", "");
+    cached.source = it->value("source", "");
+    cached.seqRead = result_from(*it, "seq_read");
+    cached.seqWrite = result_from(*it, "seq_write");
+    cached.randRead = result_from(*it, "rand_read");
+    cached.randWrite = result_from(*it, "rand_write");
+    cached.ok = cached.seqRead.ok || cached.seqWrite.ok || cached.randRead.ok || cached.randWrite.ok;
+    if (!cached.ok) return false;
+    report = cached;
+    return true;
+}
+
+void BenchmarkCache::storeDisk(const string& id, const BenchmarkOptions& options, const DiskBenchmarkReport& report) {
+    if (id.empty() || !report.ok) return;
+    json entry;
+    entry["time"] = static_cast<long long>(time(nullptr));
+    entry["options"] = options_key(options);
+    entry["engine"] = report.engine;
+    entry["source"] = report.source;
+    if (report.seqRead.ok) entry["seq_read"] = to_json(report.seqRead);
+    if (report.seqWrite.ok) entry["seq_write"] = to_json(report.seqWrite);
+    if (report.randRead.ok) entry["rand_read"] = to_json(report.randRead);
+    if (report.randWrite.ok) entry["rand_write"] = to_json(report.randWrite);
+
+    lock_guard<mutex> lock(m);
+    state->entries["disk:" + id] = entry;
+    dirty = true;
+}
+
+bool BenchmarkCache::text(const string& id, string& value, long long& age) {
+    lock_guard<mutex> lock(m);
+    if (!reuse || id.empty()) return false;
+    auto it = state->entries.find(id);
+    if (it == state->entries.end() || !it->is_object()) return false;
+
+    long long measured = it->value("time", 0LL);
+    age = static_cast<long long>(time(nullptr)) - measured;
+    if (measured <= 0 || age < 0 || age > maxAge) return false;
+
+    string cached = it->value("value", "");
+    if (cached.empty()) return false;
+    value = cached;
+    return true;
+}
+
+void BenchmarkCache::storeText(const string& id, const string& value) {
+    if (id.empty() || value.empty()) return;
+    lock_guard<mutex> lock(m);
+    state->entries[id] = { { "time", static_cast<long long>(time(nullptr)) }, { "value", value } };
+    dirty = true;
+}
+
+string BenchmarkCache::formatAge(long long seconds) {
+    if (seconds < 60) return "<1m";
+    if (seconds < 3600) return to_string(seconds / 60) + "m";
+    if (seconds < 86400) return to_string(seconds / 3600) + "h";
+    return to_string(seconds / 86400) + "d";
+}
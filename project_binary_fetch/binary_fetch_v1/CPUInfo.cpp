@@ -31,6 +31,7 @@ What we use:
    - Used for real-time CPU utilization (%)
    - Same backend Task Manager uses
    - Needs warm-up or it gives garbage data
+     (the warm-up window is shared, see UtilizationSampler)
 
 4) WinAPI system calls
    - Core count
@@ -67,6 +68,7 @@ get_cpu_utilization()
 ---------------------
 Uses PDH counters to get real-time CPU usage (%).
 This needs initialization + a delay or Windows lies :)
+The delay is paid once per run by UtilizationSampler.
 
 get_cpu_base_speed()
 --------------------
@@ -104,8 +106,8 @@ Automatically formats KB / MB.
 
 get_system_uptime()
 -------------------
-Uses GetTickCount64() to calculate how long the system
-has been running (days:hours:minutes:seconds).
+Formats the shared uptime fact (FactStore, GetTickCount64)
+as days:hours:minutes:seconds.
 
 get_process_count()
 -------------------
@@ -134,21 +136,23 @@ But it WORKS — and that’s a win :)
 ================================================================================
 */
 
-#include "include\CPUInfo.h"
+#include "include/CPUInfo.h"
+#include "include/UtilizationSampler.h" // shared CPU usage window
+#include "include/FactStore.h"        // shared uptime
+#include "include/StaticCache.h"      // brand, sockets, caches survive across runs
+
+// Windows only - the Linux implementation lives in CPUInfoLinux.cpp
+#ifdef _WIN32
 
 #include <windows.h>   // Core Windows API — sometimes pain, sometimes power
 #include <intrin.h>    // CPUID and low-level CPU instructions
 #include <vector>      // Dynamic storage (because life isn't fixed-size)
 #include <sstream>     // Turning numbers into pretty strings
 #include <wbemidl.h>   // WMI — Windows answering deep existential questions
-#include <pdh.h>       // Performance counters (Task Manager vibes)
 #include <comdef.h>    // COM helpers so we don't lose our sanity
 #include <iomanip>     // Formatting polish (decimals, padding, alignment)
 using namespace std;
 
-#pragma comment(lib, "pdh.lib")      
-// Auto-link PDH so CPU usage works without linker drama
-
 #pragma comment(lib, "wbemuuid.lib") 
 // Required for WMI / COM UUIDs — Windows won't talk without this
 
@@ -355,7 +359,7 @@ documentation (2) : CPU brand string extraction using CPUID
 */
 
 // Section (2) : CPU brand string extraction using CPUID
-string CPUInfo::get_cpu_info()
+static string read_cpu_brand()
 {
     int cpu_data[4] = { -1 };
     char cpu_brand[0x40] = { 0 };
@@ -372,6 +376,12 @@ string CPUInfo::get_cpu_info()
     return string(cpu_brand);
 }
 
+// Brand string never changes while the machine is up -> StaticCache
+string CPUInfo::get_cpu_info()
+{
+    return StaticCache::instance().text("cpu.brand", read_cpu_brand);
+}
+
 /*
 documentation (3) : CPU usage percentage (Task Manager style)
 
@@ -381,22 +391,22 @@ documentation (3) : CPU usage percentage (Task Manager style)
     Instead, it exposes performance counters through PDH
     (Performance Data Helper), which is the same system Task Manager uses.
 
-    Why all the static variables?
-    - PDH queries and counters are expensive to create.
-    - Creating them every frame would be slow and unnecessary.
-    - So we initialize them once, then reuse them forever =))
+    Why no PDH code in here anymore?
+    - PDH needs two samples with a pause in between to calculate a delta.
+    - CompactCPU, CompactPerformance and PerformanceInfo needed the exact
+      same number, and each of them used to sleep for its own window.
+    - So the query now lives in UtilizationSampler: main() takes ONE
+      baseline right after loading the config, and the first module that
+      asks takes ONE closing sample. Everyone shares that window.
 
-    How this works step-by-step:
+    How this works step-by-step (inside UtilizationSampler):
     1. Open a PDH query (this is the container for performance counters).
     2. Add the "\\Processor(_Total)\\% Processor Time" counter.
        This represents overall CPU usage across all cores.
     3. Collect initial data (PDH needs a baseline to compare against).
-    4. Wait a short moment so PDH has time to calculate a real delta.
-
-    On every call after initialization:
-    - We ask PDH to collect fresh data.
-    - We read the formatted value as a double (percentage).
-    - We return it as a float, just like Task Manager does.
+    4. When someone asks, wait out what's left of the interval
+       (sampler.interval_ms in the config),
+       collect again and read the formatted value as a double (percentage).
 
     If this looks over-engineered:
     congrats, you just discovered Windows performance APIs :)
@@ -405,25 +415,8 @@ documentation (3) : CPU usage percentage (Task Manager style)
 // Section (3) : CPU usage percentage (Task Manager style)
 float CPUInfo::get_cpu_utilization()
 {
-    static PDH_HQUERY query = NULL;
-    static PDH_HCOUNTER counter = NULL;
-    static bool initialized = false;
-
-    if (!initialized)
-    {
-        PdhOpenQuery(NULL, 0, &query);
-        PdhAddCounter(query, TEXT("\\Processor(_Total)\\% Processor Time"), 0, &counter);
-        PdhCollectQueryData(query);
-        initialized = true;
-
-        Sleep(100);
-    }
-
-    PDH_FMT_COUNTERVALUE value;
-    PdhCollectQueryData(query);
-    PdhGetFormattedCounterValue(counter, PDH_FMT_DOUBLE, NULL, &value);
-
-    return static_cast<float>(value.doubleValue);
+    // shared sampling window (see UtilizationSampler), no private sleep here
+    return static_cast<float>(UtilizationSampler::instance().cpuPercent());
 }
 
 /*
@@ -569,7 +562,7 @@ documentation (6) : Physical CPU socket count
 */
 
 // Section (6) : Physical CPU socket count
-int CPUInfo::get_cpu_sockets()
+static int read_cpu_sockets()
 {
     string value = wmi_querysingle_value
     (
@@ -578,7 +571,13 @@ int CPUInfo::get_cpu_sockets()
     );
 
     try { return stoi(value); }
-    catch (...) { return 1; }
+    catch (...) { return 0; } // not cached, caller falls back to 1
+}
+
+int CPUInfo::get_cpu_sockets()
+{
+    int sockets = StaticCache::instance().number("cpu.sockets", read_cpu_sockets);
+    return sockets > 0 ? sockets : 1;
 }
 
 /*
@@ -760,7 +759,7 @@ documentation (10) : L1 cache size per core
 */
 
 // Section (10) : L1 cache size per core
-string CPUInfo::get_cpu_l1_cache()
+static string read_cpu_l1_cache()
 {
     DWORD length = 0;
     GetLogicalProcessorInformation(NULL, &length);
@@ -788,6 +787,22 @@ string CPUInfo::get_cpu_l1_cache()
     return ss.str();
 }
 
+// Cache sizes come from StaticCache; "N/A" is never stored so a failed
+// lookup is simply retried on the next run.
+static string cached_cache_size(const char* key, string(*probe)())
+{
+    string size = StaticCache::instance().text(key, [probe] {
+        string value = probe();
+        return value == "N/A" ? string() : value;
+        });
+    return size.empty() ? "N/A" : size;
+}
+
+string CPUInfo::get_cpu_l1_cache()
+{
+    return cached_cache_size("cpu.l1_cache", read_cpu_l1_cache);
+}
+
 /*
 documentation (11) : L2 cache size
 
@@ -827,7 +842,7 @@ documentation (11) : L2 cache size
 */
 
 // Section (11) : L2 cache size
-string CPUInfo::get_cpu_l2_cache()
+static string read_cpu_l2_cache()
 {
     DWORD length = 0;
     GetLogicalProcessorInformation(NULL, &length);
@@ -855,6 +870,11 @@ string CPUInfo::get_cpu_l2_cache()
     return ss.str();
 }
 
+string CPUInfo::get_cpu_l2_cache()
+{
+    return cached_cache_size("cpu.l2_cache", read_cpu_l2_cache);
+}
+
 /*
 documentation (12) : L3 cache size (shared, last-level cache)
 
@@ -894,7 +914,7 @@ documentation (12) : L3 cache size (shared, last-level cache)
 */
 
 // Section (12) : L3 cache size (shared, last-level cache)
-string CPUInfo::get_cpu_l3_cache()
+static string read_cpu_l3_cache()
 {
     DWORD length = 0;
     GetLogicalProcessorInformation(NULL, &length);
@@ -923,6 +943,11 @@ string CPUInfo::get_cpu_l3_cache()
     return ss.str();
 }
 
+string CPUInfo::get_cpu_l3_cache()
+{
+    return cached_cache_size("cpu.l3_cache", read_cpu_l3_cache);
+}
+
 /*
 documentation (13) : System uptime calculation
 
@@ -936,7 +961,9 @@ documentation (13) : System uptime calculation
 
     Calculation method:
     ------------------
-    GetTickCount64() returns milliseconds since boot.
+    GetTickCount64() returns milliseconds since boot. It is read once
+    per run through the FactStore, so every uptime shown on screen
+    (compact, OS, CPU, performance) agrees to the millisecond.
     We convert:
     - Milliseconds → seconds
     - Seconds → minutes
@@ -967,7 +994,7 @@ documentation (13) : System uptime calculation
 // Section (13) : System uptime calculation
 string CPUInfo::get_system_uptime()
 {
-    ULONGLONG ms = GetTickCount64();
+    ULONGLONG ms = FactStore::uptimeMs();
 
     ULONGLONG seconds = ms / 1000;
     ULONGLONG minutes = seconds / 60;
@@ -1135,4 +1162,6 @@ int CPUInfo::get_handle_count()
 
     try { return stoi(value); }
     catch (...) { return 0; }
-}
\ No newline at end of file
+}
+
+#endif // _WIN32
@@ -0,0 +1,309 @@
+/*
+================================================================================
+ CPUInfoLinux.cpp — the same CPUInfo interface, Linux edition
+================================================================================
+
+CPUInfo.cpp talks to WMI, PDH and the registry, none of which exist on Linux.
+This file implements every CPUInfo function from the kernel's own files:
+
+    brand, virtualization   /proc/cpuinfo (first processor block only)
+    threads                 /sys/devices/system/cpu/online
+    cores, sockets          /sys/devices/system/cpu/cpuN/topology (sibling lists)
+    L1 / L2 / L3            /sys/devices/system/cpu/cpu0/cache/indexN
+    base / current speed    /sys/devices/system/cpu/cpu0/cpufreq
+    processes               number of /proc/<pid> directories
+    threads (system)        /proc/loadavg (4th field: running/total)
+    handles                 /proc/sys/fs/file-nr (allocated file handles)
+
+Every file is read with ONE read() into a stack buffer (see LinuxSysfs.h):
+no iostreams, no popen("lscpu"), so the whole CPU section costs a fraction
+of a millisecond. Static values still go through StaticCache and the usage /
+uptime numbers through the shared UtilizationSampler / FactStore, exactly
+like the Windows side. Output formats match CPUInfo.cpp.
+================================================================================
+*/
+#include "include/CPUInfo.h"
+
+#ifndef _WIN32
+#include "include/UtilizationSampler.h"
+#include "include/FactStore.h"
+#include "include/StaticCache.h"
+#include "include/LinuxSysfs.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+#include <dirent.h>
+using namespace std;
+
+static const char* CPU_ROOT = "/sys/devices/system/cpu";
+
+// -------------------- Helpers --------------------
+
+// online logical CPUs, expanded from "0-3,8-11"
+static vector<int> online_cpus()
+{
+    vector<int> cpus;
+    char list[256];
+    if (sysfs_read("/sys/devices/system/cpu/online", list, sizeof(list)) <= 0) return cpus;
+
+    const char* p = list;
+    while (*p) {
+        char* end = nullptr;
+        long first = strtol(p, &end, 10);
+        if (end == p) break;
+        long last = first;
+        p = end;
+        if (*p == '-') {
+            last = strtol(p + 1, &end, 10);
+            p = end;
+        }
+        for (long c = first; c <= last; ++c) cpus.push_back(static_cast<int>(c));
+        if (*p != ',') break;
+        ++p;
+    }
+    return cpus;
+}
+
+// value of "key : value" from the first processor block of /proc/cpuinfo
+static string cpuinfo_field(const char* key)
+{
+    char buf[8192];
+    if (sysfs_read("/proc/cpuinfo", buf, sizeof(buf)) <= 0) return "";
+
+    size_t keyLen = strlen(key);
+    for (char* line = buf; line && *line; ) {
+        char* next = strchr(line, '\n');
+        if (next) *next = '\0';
+
+        if (*line == '\0') break; // blank line = end of the first processor
+        if (strncmp(line, key, keyLen) == 0) {
+            // "cpu" must not match "cpu MHz": only blanks may follow the key
+            char* value = line + keyLen;
+            while (*value == ' ' || *value == '\t') ++value;
+            if (*value == ':') {
+                ++value;
+                while (*value == ' ' || *value == '\t') ++value;
+                return value;
+            }
+        }
+        line = next ? next + 1 : nullptr;
+    }
+    return "";
+}
+
+// counts CPUs that are the first entry of their own <file> list
+// (thread_siblings_list -> cores, core_siblings_list -> sockets)
+static int count_groups(const char* file)
+{
+    int groups = 0;
+    char path[128];
+    char list[256];
+    for (int cpu : online_cpus()) {
+        snprintf(path, sizeof(path), "%s/cpu%d/topology/%s", CPU_ROOT, cpu, file);
+        if (sysfs_read(path, list, sizeof(list)) <= 0) continue;
+        if (sysfs_first_cpu(list) == cpu) ++groups;
+    }
+    return groups;
+}
+
+// cpufreq reports kHz
+static string format_khz(long long khz)
+{
+    if (khz <= 0) return "N/A";
+    ostringstream ss;
+    ss << fixed << setprecision(2) << (khz / 1000000.0f) << " GHz";
+    return ss.str();
+}
+
+// total bytes of every cache instance of this level in the system.
+// cpu0 describes one instance per index; shared_cpu_list says how many
+// logical CPUs share it, so threads / sharers = number of instances.
+static unsigned long long cache_bytes(int level)
+{
+    int threads = static_cast<int>(online_cpus().size());
+    unsigned long long total = 0;
+    char path[128];
+    char buf[256];
+
+    for (int index = 0; ; ++index) {
+        snprintf(path, sizeof(path), "%s/cpu0/cache/index%d/level", CPU_ROOT, index);
+        long long l = sysfs_read_long(path, -1);
+        if (l < 0) break;
+        if (l != level) continue;
+
+        snprintf(path, sizeof(path), "%s/cpu0/cache/index%d/size", CPU_ROOT, index);
+        if (sysfs_read(path, buf, sizeof(buf)) <= 0) continue;
+        char* unit = nullptr;
+        unsigned long long size = strtoull(buf, &unit, 10);
+        if (*unit == 'K') size *= 1024ULL;
+        else if (*unit == 'M') size *= 1024ULL * 1024ULL;
+
+        snprintf(path, sizeof(path), "%s/cpu0/cache/index%d/shared_cpu_list", CPU_ROOT, index);
+        int sharers = 1;
+        if (sysfs_read(path, buf, sizeof(buf)) > 0) sharers = sysfs_count_cpu_list(buf);
+        if (sharers <= 0) sharers = 1;
+
+        int instances = threads > 0 ? (threads + sharers - 1) / sharers : 1;
+        total += size * static_cast<unsigned long long>(instances);
+    }
+    return total;
+}
+
+static string read_cpu_brand()
+{
+    string brand = cpuinfo_field("model name");          // x86
+    if (brand.empty()) brand = cpuinfo_field("Processor"); // older ARM kernels
+    if (brand.empty()) brand = cpuinfo_field("cpu");       // POWER
+    return brand;
+}
+
+static int read_cpu_sockets()
+{
+    return count_groups("core_siblings_list");
+}
+
+// same formatting as the Windows side: L1 always KB, L2/L3 KB or MB
+static string read_cpu_cache(int level)
+{
+    unsigned long long size = cache_bytes(level);
+    if (!size) return "";
+
+    ostringstream ss;
+    if (level == 1) ss << (size / 1024) << " KB";
+    else ss << (size >= 1024 * 1024 ? size / (1024 * 1024) : size / 1024)
+        << (size >= 1024 * 1024 ? " MB" : " KB");
+    return ss.str();
+}
+
+// -------------------- CPUInfo --------------------
+string CPUInfo::get_cpu_info()
+{
+    return StaticCache::instance().text("cpu.brand", read_cpu_brand);
+}
+
+float CPUInfo::get_cpu_utilization()
+{
+    return static_cast<float>(UtilizationSampler::instance().cpuPercent());
+}
+
+string CPUInfo::get_cpu_base_speed()
+{
+    // intel_pstate exposes the rated clock; other drivers only the max
+    long long khz = sysfs_read_long("/sys/devices/system/cpu/cpu0/cpufreq/base_frequency", -1);
+    if (khz <= 0) khz = sysfs_read_long("/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq", -1);
+    if (khz <= 0) {
+        // no cpufreq at all (VMs): the TSC based estimate is the nominal clock
+        string mhz = cpuinfo_field("cpu MHz");
+        if (!mhz.empty()) khz = static_cast<long long>(atof(mhz.c_str()) * 1000.0);
+    }
+    return format_khz(khz);
+}
+
+string CPUInfo::get_cpu_speed()
+{
+    long long khz = sysfs_read_long("/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq", -1);
+    if (khz <= 0) {
+        // no cpufreq driver (VMs): the kernel's own estimate in MHz
+        string mhz = cpuinfo_field("cpu MHz");
+        if (!mhz.empty()) khz = static_cast<long long>(atof(mhz.c_str()) * 1000.0);
+    }
+    return format_khz(khz);
+}
+
+int CPUInfo::get_cpu_sockets()
+{
+    int sockets = StaticCache::instance().number("cpu.sockets", read_cpu_sockets);
+    return sockets > 0 ? sockets : 1;
+}
+
+int CPUInfo::get_cpu_cores()
+{
+    int cores = count_groups("thread_siblings_list");
+    return cores > 0 ? cores : -1;
+}
+
+int CPUInfo::get_cpu_logical_processors()
+{
+    return static_cast<int>(online_cpus().size());
+}
+
+string CPUInfo::get_cpu_virtualization()
+{
+    // the kernel hides vmx/svm when the firmware has them switched off
+    string flags = " " + cpuinfo_field("flags") + " ";
+    bool on = flags.find(" vmx ") != string::npos || flags.find(" svm ") != string::npos;
+    return on ? "Enabled" : "Disabled";
+}
+
+static string cached_cache_size(const char* key, int level)
+{
+    string size = StaticCache::instance().text(key, [level] { return read_cpu_cache(level); });
+    return size.empty() ? "N/A" : size;
+}
+
+string CPUInfo::get_cpu_l1_cache()
+{
+    return cached_cache_size("cpu.l1_cache", 1);
+}
+
+string CPUInfo::get_cpu_l2_cache()
+{
+    return cached_cache_size("cpu.l2_cache", 2);
+}
+
+string CPUInfo::get_cpu_l3_cache()
+{
+    return cached_cache_size("cpu.l3_cache", 3);
+}
+
+string CPUInfo::get_system_uptime()
+{
+    unsigned long long ms = FactStore::uptimeMs();
+
+    unsigned long long seconds = ms / 1000;
+    unsigned long long minutes = seconds / 60;
+    unsigned long long hours = minutes / 60;
+    unsigned long long days = hours / 24;
+
+    ostringstream ss;
+    ss << days << ":"
+        << setw(2) << setfill('0') << (hours % 24) << ":"
+        << setw(2) << (minutes % 60) << ":"
+        << setw(2) << (seconds % 60);
+
+    return ss.str();
+}
+
+int CPUInfo::get_process_count()
+{
+    DIR* dir = opendir("/proc");
+    if (!dir) return 0;
+
+    int count = 0;
+    while (dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] >= '1' && entry->d_name[0] <= '9') ++count;
+    }
+    closedir(dir);
+    return count;
+}
+
+int CPUInfo::get_thread_count()
+{
+    // "0.12 0.08 0.05 2/1234 5678" -> 1234 scheduling entities (threads)
+    char buf[128];
+    if (sysfs_read("/proc/loadavg", buf, sizeof(buf)) <= 0) return 0;
+    const char* slash = strchr(buf, '/');
+    return slash ? atoi(slash + 1) : 0;
+}
+
+int CPUInfo::get_handle_count()
+{
+    // Linux counterpart of Windows handles: allocated file handles
+    return static_cast<int>(sysfs_read_long("/proc/sys/fs/file-nr", 0));
+}
+
+#endif
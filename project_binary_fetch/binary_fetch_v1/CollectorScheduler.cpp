@@ -0,0 +1,340 @@
+#include "include/CollectorScheduler.h"
+#include <algorithm>
+#include <iostream>
+#include <windows.h>
+#include <objbase.h>
+using namespace std;
+
+// -------------------- SectionBuffer --------------------
+void SectionBuffer::push(const string& line) {
+    owner.append(slot, line);
+}
+
+// -------------------- Construction --------------------
+CollectorScheduler::CollectorScheduler(LivePrinter& printer, unsigned workers)
+    : lp(printer), sealed(false), alive(false), leftRunning(false), startedAt(chrono::steady_clock::now()),
+    budgetMs(0), placeholder(u8"\u2026")
+{
+    // Most collectors spend their time waiting (WMI, PDH sampling, disk and
+    // network tests) rather than burning CPU, so the pool is allowed to be
+    // wider than the core count.
+    if (workers == 0) {
+        workers = thread::hardware_concurrency() * 2;
+        if (workers < 4) workers = 4;
+    }
+
+    for (unsigned i = 0; i < workers; ++i) {
+        pool.emplace_back(&CollectorScheduler::workerLoop, this);
+    }
+}
+
+CollectorScheduler::~CollectorScheduler() {
+    {
+        lock_guard<mutex> lock(m);
+        sealed = true;
+        alive = false;
+    }
+    workReady.notify_all();
+    for (auto& t : pool) {
+        if (t.joinable()) t.join();
+    }
+}
+
+// -------------------- Deadlines --------------------
+void CollectorScheduler::setBudget(unsigned ms) {
+    lock_guard<mutex> lock(m);
+    budgetMs = ms;
+}
+
+void CollectorScheduler::setTimeout(const string& name, unsigned ms) {
+    lock_guard<mutex> lock(m);
+    timeouts[name] = ms;
+}
+
+void CollectorScheduler::setPlaceholder(const string& text) {
+    lock_guard<mutex> lock(m);
+    placeholder = text;
+}
+
+void CollectorScheduler::keepAlive() {
+    lock_guard<mutex> lock(m);
+    alive = true;
+}
+
+void CollectorScheduler::setRepeating(const string& name, bool repeat) {
+    lock_guard<mutex> lock(m);
+    repeating[name] = repeat;
+    for (auto& slot : slots) {
+        if (slot->name == name) slot->repeat = repeat;
+    }
+}
+
+// earliest of the section timeout and the global budget (caller holds the lock)
+bool CollectorScheduler::deadlineFor(const Slot& slot, chrono::steady_clock::time_point& deadline) const {
+    unsigned limit = budgetMs;
+    auto it = timeouts.find(slot.name);
+    if (it != timeouts.end() && it->second > 0 && (limit == 0 || it->second < limit)) limit = it->second;
+
+    if (limit == 0) return false;
+    deadline = startedAt + chrono::milliseconds(limit);
+    return true;
+}
+
+// -------------------- Registration --------------------
+void CollectorScheduler::add(const string& name, Job job) {
+    add(name, "", move(job));
+}
+
+void CollectorScheduler::add(const string& name, const string& lane, Job job) {
+    {
+        lock_guard<mutex> lock(m);
+        unique_ptr<Slot> slot(new Slot());
+        slot->name = name;
+        slot->lane = lane;
+        slot->job = move(job);
+        auto repeat = repeating.find(name);
+        slot->repeat = repeat != repeating.end() && repeat->second;
+        slots.push_back(move(slot));
+        pending.push_back(slots.size() - 1);
+    }
+    workReady.notify_one();
+}
+
+// -------------------- Worker side --------------------
+
+// picks the first queued job whose lane is free (caller holds the lock).
+// Jobs are taken in registration order so the section at the top of the
+// screen is usually the first one to finish.
+bool CollectorScheduler::takeJob(size_t& index) {
+    for (auto it = pending.begin(); it != pending.end(); ++it) {
+        const string& lane = slots[*it]->lane;
+        if (!lane.empty() && laneOwner.count(lane)) continue;
+
+        index = *it;
+        pending.erase(it);
+        if (!lane.empty()) laneOwner[lane] = index;
+        return true;
+    }
+    return false;
+}
+
+void CollectorScheduler::workerLoop() {
+    // every worker needs its own COM apartment for the WMI based modules
+    HRESULT hr = CoInitializeEx(0, COINIT_MULTITHREADED);
+    bool comReady = SUCCEEDED(hr);
+
+    while (true) {
+        size_t index = 0;
+        Slot* slot = nullptr;
+        {
+            unique_lock<mutex> lock(m);
+            bool got = false;
+            workReady.wait(lock, [&] {
+                got = takeJob(index);
+                return got || (sealed && !alive && pending.empty());
+                });
+            if (!got) break; // queue drained and run() was called
+            slot = slots[index].get();
+            slot->running = true;
+        }
+
+        SectionBuffer buffer(*this, index);
+        try {
+            slot->job(buffer);
+        }
+        catch (const exception& e) {
+            buffer.push("Error in " + slot->name + ": " + e.what());
+        }
+        catch (...) {
+            buffer.push("Error in " + slot->name);
+        }
+
+        {
+            lock_guard<mutex> lock(m);
+            slot->done = true;
+            slot->running = false;
+            if (!alive) slot->job = nullptr; // release captured state early
+            auto owner = laneOwner.find(slot->lane);
+            if (owner != laneOwner.end() && owner->second == index) laneOwner.erase(owner);
+        }
+        lineReady.notify_all();
+        workReady.notify_all(); // a lane may have been freed
+    }
+
+    if (comReady) CoUninitialize();
+}
+
+void CollectorScheduler::append(size_t index, const string& line) {
+    {
+        lock_guard<mutex> lock(m);
+        if (slots[index]->abandoned) return; // too late, already replaced on screen
+        slots[index]->lines.push_back(line);
+    }
+    lineReady.notify_all();
+}
+
+// -------------------- Reorder buffer --------------------
+void CollectorScheduler::run() {
+    {
+        lock_guard<mutex> lock(m);
+        sealed = true;
+    }
+    workReady.notify_all();
+
+    size_t total = 0;
+    {
+        lock_guard<mutex> lock(m);
+        total = slots.size();
+    }
+
+    for (size_t i = 0; i < total; ++i) {
+        size_t printed = 0;
+        while (true) {
+            vector<string> ready;
+            bool finished = false;
+            {
+                unique_lock<mutex> lock(m);
+                Slot& slot = *slots[i];
+                auto hasWork = [&] { return slot.lines.size() > printed || slot.done; };
+
+                chrono::steady_clock::time_point deadline;
+                if (deadlineFor(slot, deadline)) {
+                    if (!lineReady.wait_until(lock, deadline, hasWork)) {
+                        abandon(i);
+                        ready.push_back(placeholder);
+                        finished = true;
+                    }
+                }
+                else {
+                    lineReady.wait(lock, hasWork);
+                }
+
+                if (!finished && slot.abandoned) {
+                    // dropped behind a hung lane owner, it never ran
+                    ready.push_back(placeholder);
+                    finished = true;
+                }
+                else if (!finished) {
+                    ready.assign(slot.lines.begin() + printed, slot.lines.end());
+                    printed = slot.lines.size();
+                    finished = slot.done;
+                }
+            }
+
+            // print outside the lock so workers never wait on the console;
+            // everything that became ready together goes out in one write
+            lp.push(ready);
+            if (finished) break;
+        }
+    }
+
+    // --watch: the same workers serve every tick()
+    {
+        lock_guard<mutex> lock(m);
+        if (alive) return;
+    }
+    release();
+}
+
+void CollectorScheduler::stop() {
+    {
+        lock_guard<mutex> lock(m);
+        alive = false;
+    }
+    workReady.notify_all();
+    release();
+}
+
+// A job that timed out can't be interrupted; its worker is left running and
+// detached so the caller isn't blocked by it. Decided once, under the lock:
+// the job may return right after, but the workers are already gone and
+// detached() keeps telling main() to leave without unwinding.
+void CollectorScheduler::release() {
+    {
+        lock_guard<mutex> lock(m);
+        for (const auto& slot : slots) {
+            if (slot->abandoned && !slot->done) leftRunning = true;
+        }
+    }
+    for (auto& t : pool) {
+        if (!t.joinable()) continue;
+        if (leftRunning) t.detach();
+        else t.join();
+    }
+}
+
+// missed the deadline: placeholder now, drop the rest later. A running job
+// keeps its lane until it returns (the lane exists so its users never overlap),
+// so the jobs queued behind it in that lane are dropped with it; a job still
+// queued gets the placeholder without ever running (caller holds the lock).
+void CollectorScheduler::abandon(size_t index) {
+    Slot& slot = *slots[index];
+    slot.abandoned = true;
+    auto queued = find(pending.begin(), pending.end(), index);
+    if (queued != pending.end()) {
+        pending.erase(queued);
+        slot.done = true;
+    }
+    else if (!slot.done && !slot.lane.empty()) {
+        dropLane(slot.lane);
+    }
+}
+
+// every queued job of <lane>: its owner is hung, they would wait for it with
+// no deadline of their own (caller holds the lock)
+void CollectorScheduler::dropLane(const string& lane) {
+    for (auto it = pending.begin(); it != pending.end();) {
+        Slot& queued = *slots[*it];
+        if (queued.lane != lane) {
+            ++it;
+            continue;
+        }
+        queued.abandoned = true;
+        queued.done = true;
+        it = pending.erase(it);
+    }
+}
+
+// -------------------- Watch ticks --------------------
+void CollectorScheduler::tick(vector<string>& lines) {
+    {
+        lock_guard<mutex> lock(m);
+        startedAt = chrono::steady_clock::now();
+        for (size_t i = 0; i < slots.size(); ++i) {
+            Slot& slot = *slots[i];
+            // a straggler from an earlier tick keeps its placeholder until it returns
+            if (!slot.repeat || slot.running || !slot.job) continue;
+            slot.lines.clear();
+            slot.done = false;
+            slot.abandoned = false;
+            pending.push_back(i);
+        }
+        // a lane still held by a straggler won't be free this tick either
+        for (const auto& owner : laneOwner) {
+            if (slots[owner.second]->abandoned) dropLane(owner.first);
+        }
+    }
+    workReady.notify_all();
+
+    lines.clear();
+    unique_lock<mutex> lock(m);
+    for (size_t i = 0; i < slots.size(); ++i) {
+        Slot& slot = *slots[i];
+        auto settled = [&] { return slot.done || slot.abandoned; };
+
+        chrono::steady_clock::time_point deadline;
+        if (deadlineFor(slot, deadline)) {
+            if (!lineReady.wait_until(lock, deadline, settled)) abandon(i);
+        }
+        else {
+            lineReady.wait(lock, settled);
+        }
+
+        if (slot.abandoned) lines.push_back(placeholder);
+        else lines.insert(lines.end(), slot.lines.begin(), slot.lines.end());
+    }
+}
+
+bool CollectorScheduler::detached() const {
+    return leftRunning;
+}
@@ -1,4 +1,4 @@
-#include "include\CompactAudio.h"
+#include "include/CompactAudio.h"
 #include <windows.h>
 #include <mmdeviceapi.h>
 #include <functiondiscoverykeys_devpkey.h>
@@ -8,13 +8,15 @@
 using namespace std;
 
 string get_audio_device_name(EDataFlow flow) {
-    CoInitialize(NULL);
+    // the collector workers already joined the multithreaded apartment, so
+    // this fails with RPC_E_CHANGED_MODE there and must not be undone
+    bool needsUninit = SUCCEEDED(CoInitialize(NULL));
     CComPtr<IMMDeviceEnumerator> pEnum;
     pEnum.CoCreateInstance(__uuidof(MMDeviceEnumerator));
 
     CComPtr<IMMDevice> pDevice;
     if (FAILED(pEnum->GetDefaultAudioEndpoint(flow, eConsole, &pDevice))) {
-        CoUninitialize();
+        if (needsUninit) CoUninitialize();
         return flow == eRender ? "No speaker found" : "No microphone found";
     }
 
@@ -30,7 +32,7 @@ string get_audio_device_name(EDataFlow flow) {
     string result(ws.begin(), ws.end());  // simple conversion
 
     PropVariantClear(&varName);
-    CoUninitialize();
+    if (needsUninit) CoUninitialize();
     return result;
 }
 
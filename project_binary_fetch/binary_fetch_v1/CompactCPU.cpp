@@ -1,19 +1,17 @@
-#include "include\CompactCPU.h"
+#include "include/CompactCPU.h"
+#include "include/UtilizationSampler.h"
+#include "include/StaticCache.h"
 #include <windows.h>
-#include <pdh.h>
-#include <pdhmsg.h>
 #include <intrin.h>
 #include <vector>
-#include <thread>
-#include <chrono>
 #include <cstring>
 #include <sstream>
 #include <iomanip>
 using namespace std;
-#pragma comment(lib, "pdh.lib")
 
 //---------------- Get CPU Name ------------------
-string CompactCPU::getCPUName()
+// raw CPUID brand string (same value CPUInfo caches as "cpu.brand")
+static string readCPUBrand()
 {
     int cpuInfo[4] = { -1 };
     char cpuBrand[0x40];
@@ -29,7 +27,12 @@ string CompactCPU::getCPUName()
         else if (i == 0x80000004) memcpy(cpuBrand + 32, cpuInfo, sizeof(cpuInfo));
     }
 
-    string name(cpuBrand);
+    return string(cpuBrand);
+}
+
+string CompactCPU::getCPUName()
+{
+    string name = StaticCache::instance().text("cpu.brand", readCPUBrand);
     name.erase(name.find_last_not_of(' ') + 1);
     return name;
 }
@@ -77,20 +80,8 @@ double CompactCPU::getClockSpeed()
     return static_cast<double>(mhz) / 1000.0;
 }
 
-//---------------- Get CPU Usage (%) Using PDH ------------------
+//---------------- Get CPU Usage (%) From The Shared Sampler ------------------
 double CompactCPU::getUsagePercent()
 {
-    PDH_HQUERY query;
-    PDH_HCOUNTER counter;
-    PDH_FMT_COUNTERVALUE counterVal;
-
-    PdhOpenQuery(nullptr, 0, &query);
-    PdhAddCounter(query, L"\\Processor(_Total)\\% Processor Time", 0, &counter);
-    PdhCollectQueryData(query);
-    this_thread::sleep_for(chrono::milliseconds(500));
-    PdhCollectQueryData(query);
-    PdhGetFormattedCounterValue(counter, PDH_FMT_DOUBLE, nullptr, &counterVal);
-    double usage = counterVal.doubleValue;
-    PdhCloseQuery(query);
-    return usage;
+    return UtilizationSampler::instance().cpuPercent();
 }
@@ -1,4 +1,5 @@
-#include "include\CompactGPU.h"
+#include "include/CompactGPU.h"
+#include "include/FactStore.h"
 #include <windows.h>
 #include <wbemidl.h>
 #include <comdef.h>
@@ -75,6 +76,20 @@ static bool queryWMIFloat(const wchar_t* wql, const wchar_t* field, float& outVa
     return ok;
 }
 
+// The adapter the compact line talks about: the first NVIDIA one if there is
+// one (that is what the NVAPI path used to report), otherwise the first real
+// adapter DXGI lists (skipping the Microsoft Basic Render Driver).
+static bool primaryAdapter(GpuAdapter& out) {
+    vector<GpuAdapter> adapters = FactStore::gpuAdapters();
+    for (const auto& a : adapters) {
+        if (a.vendorId == 0x10DE) { out = a; return true; }
+    }
+    for (const auto& a : adapters) {
+        if (a.vendorId != 0x1414) { out = a; return true; }
+    }
+    return false;
+}
+
 // -------------------- NVAPI Utilization Enum (for older headers) --------------------
 #ifndef NVAPI_GPU_UTILIZATION_GPU
 enum NV_GPU_UTILIZATION {
@@ -89,18 +104,9 @@ enum NV_GPU_UTILIZATION {
 // -------------------- CompactGPU Implementations --------------------
 
 string CompactGPU::getGPUName() {
-    if (isNvapiAvailable() && NvAPI_Initialize() == NVAPI_OK) {
-        NvPhysicalGpuHandle nvGPU[64];
-        NvU32 count = 0;
-        if (NvAPI_EnumPhysicalGPUs(nvGPU, &count) == NVAPI_OK && count > 0) {
-            NvAPI_ShortString name;
-            if (NvAPI_GPU_GetFullName(nvGPU[0], name) == NVAPI_OK) {
-                NvAPI_Unload();
-                return string(name);
-            }
-        }
-        NvAPI_Unload();
-    }
+    GpuAdapter adapter;
+    if (primaryAdapter(adapter) && !adapter.name.empty())
+        return adapter.name;
 
     // Fallback: Registry
     HKEY hKey;
@@ -138,19 +144,9 @@ string CompactGPU::getGPUName() {
 }
 
 double CompactGPU::getVRAMGB() {
-    if (isNvapiAvailable() && NvAPI_Initialize() == NVAPI_OK) {
-        NvPhysicalGpuHandle nvGPU[64];
-        NvU32 count = 0;
-        if (NvAPI_EnumPhysicalGPUs(nvGPU, &count) == NVAPI_OK && count > 0) {
-            NV_GPU_MEMORY_INFO_EX memInfo = {};
-            memInfo.version = NV_GPU_MEMORY_INFO_EX_VER;
-            if (NvAPI_GPU_GetMemoryInfoEx(nvGPU[0], &memInfo) == NVAPI_OK) {
-                NvAPI_Unload();
-                return static_cast<double>(memInfo.dedicatedVideoMemory) / (1024.0 * 1024.0 * 1024.0);
-            }
-        }
-        NvAPI_Unload();
-    }
+    GpuAdapter adapter;
+    if (primaryAdapter(adapter))
+        return static_cast<double>(adapter.vramBytes) / (1024.0 * 1024.0 * 1024.0);
     return 0.0;
 }
 
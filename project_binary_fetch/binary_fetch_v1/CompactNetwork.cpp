@@ -1,8 +1,14 @@
-#include "include\CompactNetwork.h"  
+#include "include/CompactNetwork.h"  
 // Custom project header file.
 // Likely contains declarations for the CompactNetwork class,
 // function prototypes, constants, and internal networking logic.
 
+#include "include/FactStore.h"
+// Per-run fact cache (the WiFi SSID is probed once and shared).
+
+// Windows only - the Linux implementation lives in CompactNetworkLinux.cpp
+#ifdef _WIN32
+
 #include <string>  
 // Provides std::string for safe and flexible text handling.
 // Useful for storing IP addresses, SSIDs, adapter names, etc.
@@ -35,14 +41,6 @@
 // - Network statistics
 // Common functions: GetAdaptersInfo(), GetAdaptersAddresses().
 
-#include <wlanapi.h>  
-// Windows WLAN (Wi-Fi) API.
-// Used for wireless-specific operations:
-// - Scanning available Wi-Fi networks
-// - Retrieving SSID and signal strength
-// - Managing wireless profiles
-// - Connecting/disconnecting Wi-Fi networks
-
 #include <windows.h>  
 // Core Windows operating system API.
 // Provides access to system-level features such as:
@@ -55,7 +53,6 @@
 
 #pragma comment(lib, "ws2_32.lib")
 #pragma comment(lib, "iphlpapi.lib")
-#pragma comment(lib, "wlanapi.lib")
 #pragma comment(lib, "ole32.lib")
 
 // ------------------- Public Functions -------------------
@@ -139,68 +136,10 @@ std::string CompactNetwork::get_network_ip() {
 
 
 // Retrieves the currently connected WiFi SSID.
-// Uses Windows WLAN API.
+// The WLAN query itself lives in FactStore: get_network_name() and
+// get_network_type() both need it, but it only runs once per run.
 std::string CompactNetwork::get_wifi_ssid() {
-
-    HANDLE hClient = NULL;
-    DWORD dwMaxClient = 2;        // WLAN API version
-    DWORD dwCurVersion = 0;
-
-    // Step 1: Open connection to WLAN service
-    if (WlanOpenHandle(dwMaxClient, NULL, &dwCurVersion, &hClient) != ERROR_SUCCESS)
-        return "";
-
-    PWLAN_INTERFACE_INFO_LIST pIfList = NULL;
-
-    // Step 2: Get list of wireless interfaces (WiFi adapters)
-    if (WlanEnumInterfaces(hClient, NULL, &pIfList) != ERROR_SUCCESS) {
-        WlanCloseHandle(hClient, NULL);
-        return "";
-    }
-
-    std::string ssid = "";
-
-    // Step 3: Loop through all WiFi interfaces
-    for (unsigned int i = 0; i < pIfList->dwNumberOfItems; ++i) {
-
-        PWLAN_INTERFACE_INFO pIfInfo = &pIfList->InterfaceInfo[i];
-        PWLAN_CONNECTION_ATTRIBUTES pConnectInfo = NULL;
-
-        DWORD connectSize = sizeof(WLAN_CONNECTION_ATTRIBUTES);
-        WLAN_OPCODE_VALUE_TYPE opCode;
-
-        // Step 4: Query current connection info for this interface
-        if (WlanQueryInterface(
-            hClient,
-            &pIfInfo->InterfaceGuid,
-            wlan_intf_opcode_current_connection,
-            NULL,
-            &connectSize,
-            (PVOID*)&pConnectInfo,
-            &opCode) == ERROR_SUCCESS) {
-
-            // Step 5: Check if interface is connected
-            if (pConnectInfo->isState == wlan_interface_state_connected) {
-
-                // Extract SSID from connection attributes
-                ssid = std::string(
-                    (char*)pConnectInfo->wlanAssociationAttributes.dot11Ssid.ucSSID,
-                    pConnectInfo->wlanAssociationAttributes.dot11Ssid.uSSIDLength
-                );
-
-                WlanFreeMemory(pConnectInfo);
-                break;  // Stop once connected WiFi is found
-            }
-
-            WlanFreeMemory(pConnectInfo);
-        }
-    }
-
-    // Step 6: Clean up allocated resources
-    WlanFreeMemory(pIfList);
-    WlanCloseHandle(hClient, NULL);
-
-    return ssid;
+    return FactStore::wifiSsid();
 }
 
 
@@ -234,4 +173,6 @@ std::string CompactNetwork::get_ethernet_name() {
     }
 
     return "";
-}
\ No newline at end of file
+}
+
+#endif // _WIN32
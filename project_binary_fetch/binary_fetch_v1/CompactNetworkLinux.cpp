@@ -0,0 +1,54 @@
+#include "include/CompactNetwork.h"
+// Linux side of CompactNetwork: everything comes from the shared netlink
+// snapshot (FactStore::network()), the shown adapter is the one holding
+// the default route instead of "WiFi if any SSID, else the first Ethernet".
+
+#ifndef _WIN32
+#include "include/FactStore.h"
+
+#include <sys/socket.h>
+
+// ------------------- Public Functions -------------------
+
+// WiFi SSID if the active interface is wireless, else its interface name
+std::string CompactNetwork::get_network_name() {
+    std::string ssidName = get_wifi_ssid();
+    if (!ssidName.empty()) return ssidName;
+
+    std::string adapterName = get_ethernet_name();
+    return adapterName.empty() ? "Unknown" : adapterName;
+}
+
+// "WiFi" when the default route goes out over a wireless interface
+std::string CompactNetwork::get_network_type() {
+    NetSnapshot net = FactStore::network();
+    const NetInterface* nic = net.active();
+    return (nic && nic->wireless) ? "WiFi" : "Ethernet";
+}
+
+// IPv4 address of the active interface
+std::string CompactNetwork::get_network_ip() {
+    NetSnapshot net = FactStore::network();
+    const NetInterface* nic = net.active();
+    if (nic) {
+        for (const auto& a : nic->addresses) {
+            if (a.family == AF_INET) return a.address;
+        }
+    }
+    return "Unknown";
+}
+
+// ------------------- Private Helpers -------------------
+
+std::string CompactNetwork::get_wifi_ssid() {
+    return FactStore::wifiSsid();
+}
+
+// interface name of the active (default route) interface
+std::string CompactNetwork::get_ethernet_name() {
+    NetSnapshot net = FactStore::network();
+    const NetInterface* nic = net.active();
+    return nic ? nic->name : "";
+}
+
+#endif
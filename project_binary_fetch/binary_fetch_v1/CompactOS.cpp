@@ -1,4 +1,5 @@
-#include "include\CompactOS.h"
+#include "include/CompactOS.h"
+#include "include/FactStore.h"
 #include <sstream>
 #include <iomanip>
 #include <Windows.h>
@@ -64,7 +65,7 @@ string CompactOS::getOSBuild()
 //---------------- Get OS Uptime -----------------
 string CompactOS::getUptime()
 {
-    ULONGLONG ms = GetTickCount64();
+    ULONGLONG ms = FactStore::uptimeMs();
     ULONGLONG seconds = ms / 1000;
     int days = (int)(seconds / 86400);
     int hours = (int)((seconds % 86400) / 3600);
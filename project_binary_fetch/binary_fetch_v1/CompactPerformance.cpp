@@ -1,23 +1,11 @@
-#include "include\CompactPerformance.h"
-#include <pdh.h>
-#include <pdhmsg.h>
-#include <thread>
-#include <chrono>
+#include "include/CompactPerformance.h"
+#include "include/UtilizationSampler.h"
 #include <vector>
 #include <string>
-#include "nvapi.h"
+#include "include/NvapiGpu.h"
 using namespace std;
-#pragma comment(lib, "pdh.lib")
 #pragma comment(lib, "nvapi64.lib")
 
-// -------------------- Helpers --------------------
-static bool isNvapiAvailable() {
-    HMODULE hNvapi = LoadLibraryA("nvapi64.dll");
-    if (!hNvapi) return false;
-    FreeLibrary(hNvapi);
-    return true;
-}
-
 // NVAPI Utilization Enum (for older headers)
 #ifndef NVAPI_GPU_UTILIZATION_GPU
 enum NV_GPU_UTILIZATION {
@@ -31,29 +19,8 @@ enum NV_GPU_UTILIZATION {
 
 // -------------------- CPU Usage --------------------
 int CompactPerformance::getCPUUsage() {
-    PDH_HQUERY query;
-    PDH_HCOUNTER counter;
-    PDH_FMT_COUNTERVALUE counterVal;
-
-    if (PdhOpenQuery(nullptr, 0, &query) != ERROR_SUCCESS) return -1;
-    if (PdhAddCounter(query, L"\\Processor(_Total)\\% Processor Time", 0, &counter) != ERROR_SUCCESS) {
-        PdhCloseQuery(query);
-        return -1;
-    }
-
-    // Sample twice for accurate reading
-    PdhCollectQueryData(query);
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    PdhCollectQueryData(query);
-
-    if (PdhGetFormattedCounterValue(counter, PDH_FMT_DOUBLE, nullptr, &counterVal) != ERROR_SUCCESS) {
-        PdhCloseQuery(query);
-        return -1;
-    }
-
-    double usage = counterVal.doubleValue;
-    PdhCloseQuery(query);
-    return static_cast<int>(usage);
+    // shared sampling window instead of a private 500 ms sleep
+    return static_cast<int>(UtilizationSampler::instance().cpuPercent());
 }
 
 // -------------------- RAM Usage --------------------
@@ -71,47 +38,25 @@ int CompactPerformance::getDiskUsage() {
     return static_cast<int>(100.0 * (totalBytes.QuadPart - totalFreeBytes.QuadPart) / totalBytes.QuadPart);
 }
 
+// physical disk busy time over the shared window, like CPU and GPU
+// ("disk_usage_mode": "busy")
+int CompactPerformance::getDiskBusy() {
+    double usage = UtilizationSampler::instance().diskPercent();
+    return (usage >= 0.0) ? static_cast<int>(usage) : -1;
+}
+
 // -------------------- GPU Usage --------------------
 int CompactPerformance::getGPUUsage() {
     // --- NVIDIA GPU via NVAPI ---
-    if (isNvapiAvailable() && NvAPI_Initialize() == NVAPI_OK) {
-        NvPhysicalGpuHandle nvGPU[64];
-        NvU32 count = 0;
-        if (NvAPI_EnumPhysicalGPUs(nvGPU, &count) == NVAPI_OK && count > 0) {
-            NV_GPU_DYNAMIC_PSTATES_INFO_EX dynStates = {};
-            dynStates.version = NV_GPU_DYNAMIC_PSTATES_INFO_EX_VER; // correct version
-            if (NvAPI_GPU_GetDynamicPstatesInfoEx(nvGPU[0], &dynStates) == NVAPI_OK) {
-                NvAPI_Unload();
-                return static_cast<int>(dynStates.utilization[NVAPI_GPU_UTILIZATION_GPU].percentage);
-            }
-        }
-        NvAPI_Unload();
-    }
-
-    // --- Non-NVIDIA: PDH GPU counter (3D engines only) ---
-    PDH_HQUERY query;
-    PDH_HCOUNTER counter;
-    PDH_FMT_COUNTERVALUE value;
-
-    if (PdhOpenQuery(NULL, 0, &query) != ERROR_SUCCESS) return -1;
-
-    std::vector<std::wstring> engines = { L"\\GPU Engine(*_3D)\\Utilization Percentage" };
-    int total = 0, count = 0;
-
-    for (auto& eng : engines) {
-        if (PdhAddEnglishCounter(query, eng.c_str(), 0, &counter) != ERROR_SUCCESS) continue;
-
-        PdhCollectQueryData(query);
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        PdhCollectQueryData(query);
-
-        if (PdhGetFormattedCounterValue(counter, PDH_FMT_LONG, NULL, &value) == ERROR_SUCCESS) {
-            total += value.longValue;
-            count++;
+    if (NvPhysicalGpuHandle nvGPU = nvapiFirstGpu()) {
+        NV_GPU_DYNAMIC_PSTATES_INFO_EX dynStates = {};
+        dynStates.version = NV_GPU_DYNAMIC_PSTATES_INFO_EX_VER; // correct version
+        if (NvAPI_GPU_GetDynamicPstatesInfoEx(nvGPU, &dynStates) == NVAPI_OK) {
+            return static_cast<int>(dynStates.utilization[NVAPI_GPU_UTILIZATION_GPU].percentage);
         }
-        PdhRemoveCounter(counter);
     }
 
-    PdhCloseQuery(query);
-    return (count > 0) ? total / count : 0;
+    // --- Non-NVIDIA: PDH GPU counter (3D engines only), sampled by UtilizationSampler ---
+    double usage = UtilizationSampler::instance().gpuPercent();
+    return (usage >= 0.0) ? static_cast<int>(usage) : 0;
 }
@@ -1,10 +1,13 @@
-﻿#include "include\CompactScreen.h"
+﻿#include "include/CompactScreen.h"
 
+// DXGI / registry on Windows; the Linux side (DRM sysfs) is in CompactScreenLinux.cpp
+#ifdef _WIN32
 #include <windows.h>
 #include <dxgi1_6.h>
 #include <ShellScalingApi.h>
 #include <SetupApi.h>
 #include <cfgmgr32.h>
+#endif
 #include <string>
 #include <vector>
 #include <cmath>
@@ -13,11 +16,14 @@
 #include <cwctype>
 using namespace std;
 
+#ifdef _WIN32
 #pragma comment(lib, "dxgi.lib")
 #pragma comment(lib, "Shcore.lib")
 #pragma comment(lib, "SetupAPI.lib")
 #pragma comment(lib, "cfgmgr32.lib")
+#endif
 
+#ifdef _WIN32
 // Helper: UTF-16 -> UTF-8
 static string WideToUtf8(const wchar_t* w) {
     if (!w) return {};
@@ -28,6 +34,7 @@ static string WideToUtf8(const wchar_t* w) {
     if (!s.empty() && s.back() == '\0') s.pop_back();
     return s;
 }
+#endif
 
 CompactScreen::CompactScreen() {
     refresh();
@@ -35,9 +42,13 @@ CompactScreen::CompactScreen() {
 
 bool CompactScreen::refresh() {
     screens.clear();
+#ifdef _WIN32
     if (!populateFromDXGI()) return false;
     enrichWithNVAPI();
     enrichWithADL();
+#else
+    if (!populateFromDRM()) return false;
+#endif
     return !screens.empty();
 }
 
@@ -68,6 +79,7 @@ int CompactScreen::computeUpscaleFactor(int currentWidth, int nativeWidth) {
     return static_cast<int>(round(ratio));
 }
 
+#ifdef _WIN32
 bool CompactScreen::isNvidiaPresent() {
     DISPLAY_DEVICEW dd{};
     dd.cb = sizeof(dd);
@@ -89,6 +101,7 @@ bool CompactScreen::isAMDPresent() {
     }
     return false;
 }
+#endif
 
 CompactScreen::EDIDInfo CompactScreen::parseEDID(const unsigned char* edid, size_t size) {
     EDIDInfo info = { "", 0, 0, false };
@@ -109,7 +122,7 @@ CompactScreen::EDIDInfo CompactScreen::parseEDID(const unsigned char* edid, size
     }
 
     // Extract monitor name from descriptor blocks (0xFC descriptor type)
-    for (int i = 54; i < 126; i += 18) {
+    for (size_t i = 54; i < 126; i += 18) {
         if (i + 17 >= size) break;
         if (edid[i] == 0x00 && edid[i + 1] == 0x00 && edid[i + 3] == 0xFC) {
             string name;
@@ -129,6 +142,7 @@ CompactScreen::EDIDInfo CompactScreen::parseEDID(const unsigned char* edid, size
     return info;
 }
 
+#ifdef _WIN32
 string CompactScreen::getFriendlyNameFromEDID(const wstring& deviceName) {
     // Attempt to derive the monitor hardware ID for this DXGI device name.
     // This improves matching against the registry entries under
@@ -493,4 +507,6 @@ bool CompactScreen::enrichWithADL() {
     // ADL integration can be added here for more accurate VSR detection
 #endif
     return true;
-}
\ No newline at end of file
+}
+
+#endif // _WIN32
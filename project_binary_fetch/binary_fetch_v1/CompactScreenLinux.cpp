@@ -0,0 +1,44 @@
+#include "include/CompactScreen.h"
+
+// Linux side of CompactScreen: connected DRM connectors and their raw EDID,
+// fed to the same parseEDID() as on Windows (see LinuxDrm.h).
+#ifndef _WIN32
+#include "include/LinuxDrm.h"
+
+using namespace std;
+
+bool CompactScreen::populateFromDRM() {
+    for (const auto& out : drm_connected_outputs()) {
+        EDIDInfo edidInfo = parseEDID(out.edid.data(), out.edid.size());
+
+        // preferred mode first; EDID native timing when the list is empty
+        int currentW = 0, currentH = 0;
+        if (!out.modes.empty()) {
+            currentW = out.modes[0].first;
+            currentH = out.modes[0].second;
+        }
+        else if (edidInfo.valid) {
+            currentW = edidInfo.nativeWidth;
+            currentH = edidInfo.nativeHeight;
+        }
+
+        int refresh = drm_edid_refresh_rate(out.edid.data(), out.edid.size());
+        if (refresh <= 1) refresh = 60;
+
+        ScreenInfo info;
+        info.name = !edidInfo.friendlyName.empty() ? edidInfo.friendlyName : out.connector;
+        info.native_width = currentW;  // SHOW APPLIED RESOLUTION (same as Windows)
+        info.native_height = currentH;
+        info.current_width = currentW;
+        info.current_height = currentH;
+        info.refresh_rate = refresh;
+        info.scale_percent = 100;
+        info.scale_mul = scaleMultiplier(100);
+        info.upscale = "1x";
+
+        screens.push_back(info);
+    }
+    return !screens.empty();
+}
+
+#endif
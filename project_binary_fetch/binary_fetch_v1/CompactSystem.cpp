@@ -1,4 +1,6 @@
-#include "include\CompactSystem.h"
+#include "include/CompactSystem.h"
+#include "include/StaticCache.h"
+#include "include/SMBIOSParser.h"
 #include <windows.h>
 #include <string>
 #include <iostream>
@@ -25,42 +27,28 @@ string readRegistryValue(HKEY root, const string& subkey, const string& valueNam
         return "Unknown";
 }
 
-string CompactSystem::getBIOSInfo() {
-    // Registry paths for BIOS
-    string biosVersion = readRegistryValue(
-        HKEY_LOCAL_MACHINE,
-        "HARDWARE\\DESCRIPTION\\System\\BIOS",
-        "BIOSVersion"
-    );
-
-    string biosVendor = readRegistryValue(
-        HKEY_LOCAL_MACHINE,
-        "HARDWARE\\DESCRIPTION\\System\\BIOS",
-        "BIOSVendor"
-    );
+// Same cache keys and SMBIOS pass as SystemInfo, so whichever module runs first fills them
+static string cachedBIOSValue(const string& key, string SMBIOSInfo::* field, const string& valueName) {
+    string value = StaticCache::instance().text(key, [&] {
+        string v = smbios_system().*field;
+        if (!v.empty()) return v;
+        v = readRegistryValue(HKEY_LOCAL_MACHINE, "HARDWARE\\DESCRIPTION\\System\\BIOS", valueName);
+        return v == "Unknown" ? string() : v;
+        });
+    return value.empty() ? "Unknown" : value;
+}
 
-    string biosDate = readRegistryValue(
-        HKEY_LOCAL_MACHINE,
-        "HARDWARE\\DESCRIPTION\\System\\BIOS",
-        "BIOSReleaseDate"
-    );
+string CompactSystem::getBIOSInfo() {
+    string biosVersion = cachedBIOSValue("bios.version", &SMBIOSInfo::biosVersion, "BIOSVersion");
+    string biosVendor = cachedBIOSValue("bios.vendor", &SMBIOSInfo::biosVendor, "BIOSVendor");
+    string biosDate = cachedBIOSValue("bios.date", &SMBIOSInfo::biosDate, "BIOSReleaseDate");
 
     return biosVendor + " " + biosVersion + " (" + biosDate + ")";
 }
 
 string CompactSystem::getMotherboardInfo() {
-    // Registry paths for Motherboard (BaseBoard)
-    string boardProduct = readRegistryValue(
-        HKEY_LOCAL_MACHINE,
-        "HARDWARE\\DESCRIPTION\\System\\BIOS",
-        "BaseBoardProduct"
-    );
-
-    string boardManufacturer = readRegistryValue(
-        HKEY_LOCAL_MACHINE,
-        "HARDWARE\\DESCRIPTION\\System\\BIOS",
-        "BaseBoardManufacturer"
-    );
+    string boardProduct = cachedBIOSValue("board.model", &SMBIOSInfo::boardModel, "BaseBoardProduct");
+    string boardManufacturer = cachedBIOSValue("board.manufacturer", &SMBIOSInfo::boardManufacturer, "BaseBoardManufacturer");
 
     return boardManufacturer + " " + boardProduct;
 }
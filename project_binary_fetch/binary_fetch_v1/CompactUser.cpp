@@ -1,4 +1,4 @@
-#include "include\CompactUser.h"
+#include "include/CompactUser.h"
 #include <Windows.h>
 #include <lmcons.h>
 #include <iostream>
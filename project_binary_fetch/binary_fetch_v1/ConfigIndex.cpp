@@ -0,0 +1,395 @@
+#include "include/ConfigIndex.h"
+#include <fstream>
+#include <cstdint>
+
+using namespace std;
+using json = nlohmann::json;
+
+// -------------------- Image layout --------------------
+// Header | Entry[entryCount] | uint32 slots[slotCount] | uint64 bits[bitWords] | strings
+// Offsets only, no pointers, so the same bytes work built in memory or mapped.
+
+static const char SNAPSHOT_MAGIC[8] = { 'B', 'F', 'C', 'O', 'N', 'F', 'I', 'G' };
+static const uint32_t SNAPSHOT_FORMAT = 1;
+static const uint8_t NO_COLOR = 0xFF;
+
+struct ConfigIndex::Header {
+    char magic[8];
+    uint32_t format;
+    uint32_t entryCount;
+    uint32_t slotCount;            // power of two, open addressing: entry index + 1, 0 = empty
+    uint32_t bitWords;
+    uint64_t sourceTime;           // JSON last write time (0 = unknown, check the hash)
+    uint64_t sourceSize;
+    uint64_t sourceHash;           // FNV-1a of the JSON text
+    uint64_t paletteHash;          // color table the ANSI indexes refer to
+    uint32_t stringBytes;
+    uint32_t reserved;
+};
+
+struct ConfigIndex::Entry {
+    enum Kind : uint8_t { Object, Bool, String, Number, Other };
+
+    uint32_t keyOffset;            // full dotted path, in the string area
+    uint32_t keyLength;
+    uint32_t textOffset;           // String
+    uint32_t textLength;
+    uint32_t bit;                  // Bool: index into the bitset
+    uint8_t kind;
+    uint8_t color;                 // String naming a palette color: its index, else NO_COLOR
+    uint8_t unused[2];
+    double number;                 // Number
+};
+
+static_assert(sizeof(ConfigIndex::Header) == 64, "snapshot header layout");
+static_assert(sizeof(ConfigIndex::Entry) == 32, "snapshot entry layout");
+
+// -------------------- Hashing --------------------
+// FNV-1a over "a.b.c" without ever building that string
+
+static const unsigned long long FNV_OFFSET = 14695981039346656037ULL;
+static const unsigned long long FNV_PRIME = 1099511628211ULL;
+
+static unsigned long long hash_bytes(unsigned long long h, const char* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        h ^= static_cast<unsigned char>(data[i]);
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+static unsigned long long hash_parts(const ConfigKey* parts, size_t count) {
+    unsigned long long h = FNV_OFFSET;
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) h = hash_bytes(h, ".", 1);
+        h = hash_bytes(h, parts[i].data, parts[i].size);
+    }
+    return h;
+}
+
+// <key> == parts joined with '.'
+static bool key_equals(const char* key, size_t length, const ConfigKey* parts, size_t count) {
+    size_t pos = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) {
+            if (pos >= length || key[pos] != '.') return false;
+            ++pos;
+        }
+        if (length - pos < parts[i].size) return false;
+        if (memcmp(key + pos, parts[i].data, parts[i].size) != 0) return false;
+        pos += parts[i].size;
+    }
+    return pos == length;
+}
+
+// -------------------- Image access --------------------
+
+static const ConfigIndex::Header* header_of(const char* image) {
+    return reinterpret_cast<const ConfigIndex::Header*>(image);
+}
+
+static const ConfigIndex::Entry* entries_of(const char* image) {
+    return reinterpret_cast<const ConfigIndex::Entry*>(image + sizeof(ConfigIndex::Header));
+}
+
+static const uint32_t* slots_of(const char* image) {
+    return reinterpret_cast<const uint32_t*>(entries_of(image) + header_of(image)->entryCount);
+}
+
+static const uint64_t* bits_of(const char* image) {
+    return reinterpret_cast<const uint64_t*>(slots_of(image) + header_of(image)->slotCount);
+}
+
+static const char* strings_of(const char* image) {
+    return reinterpret_cast<const char*>(bits_of(image) + header_of(image)->bitWords);
+}
+
+static size_t image_size(uint32_t entries, uint32_t slots, uint32_t bitWords, uint32_t stringBytes) {
+    return sizeof(ConfigIndex::Header) + entries * sizeof(ConfigIndex::Entry) +
+        slots * sizeof(uint32_t) + bitWords * sizeof(uint64_t) + stringBytes;
+}
+
+// -------------------- JSON text --------------------
+
+static bool read_file(const string& path, string& out) {
+    ifstream in(path, ios::binary);
+    if (!in.is_open()) return false;
+    out.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    return true;
+}
+
+// -------------------- Construction --------------------
+
+ConfigIndex::ConfigIndex(const map<string, string>& colors)
+    : palette(colors.begin(), colors.end()), paletteHash(FNV_OFFSET),
+      image(nullptr), sourceTime(0), sourceSize(0) {
+    for (const auto& c : palette) {
+        paletteHash = hash_bytes(paletteHash, c.first.c_str(), c.first.size() + 1);
+        paletteHash = hash_bytes(paletteHash, c.second.c_str(), c.second.size() + 1);
+    }
+}
+
+ConfigIndex::~ConfigIndex() {}
+
+// -------------------- Compile --------------------
+
+namespace {
+    struct Node {
+        string key;
+        const json* value;
+    };
+}
+
+// depth first, parents before children, in the JSON's own order
+static void flatten(const string& key, const json& node, vector<Node>& out) {
+    out.push_back({ key, &node });
+    if (!node.is_object()) return;
+    for (auto it = node.begin(); it != node.end(); ++it) flatten(key + "." + it.key(), it.value(), out);
+}
+
+void ConfigIndex::compile(const json& config, const string& text) {
+    snapshot.close();
+    owned.clear();
+
+    vector<Node> nodes;
+    if (config.is_object()) {
+        for (auto it = config.begin(); it != config.end(); ++it) flatten(it.key(), it.value(), nodes);
+    }
+
+    vector<Entry> entries(nodes.size());
+    string strings;
+    uint32_t bools = 0;
+    vector<uint64_t> bits;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const json& value = *nodes[i].value;
+        Entry& e = entries[i];
+        memset(&e, 0, sizeof(e));
+        e.color = NO_COLOR;
+        e.keyOffset = static_cast<uint32_t>(strings.size());
+        e.keyLength = static_cast<uint32_t>(nodes[i].key.size());
+        strings += nodes[i].key;
+
+        if (value.is_object()) {
+            e.kind = Entry::Object;
+        }
+        else if (value.is_boolean()) {
+            e.kind = Entry::Bool;
+            e.bit = bools++;
+            if (bits.size() * 64 < bools) bits.push_back(0);
+            if (value.get<bool>()) bits[e.bit / 64] |= 1ULL << (e.bit % 64);
+        }
+        else if (value.is_string()) {
+            // color names resolve once, here
+            const string& s = value.get_ref<const string&>();
+            e.kind = Entry::String;
+            e.textOffset = static_cast<uint32_t>(strings.size());
+            e.textLength = static_cast<uint32_t>(s.size());
+            strings += s;
+            for (size_t c = 0; c < palette.size(); ++c) {
+                if (c < NO_COLOR && palette[c].first == s) { e.color = static_cast<uint8_t>(c); break; }
+            }
+        }
+        else if (value.is_number()) {
+            e.kind = Entry::Number;
+            e.number = value.get<double>();
+        }
+        else {
+            e.kind = Entry::Other;
+        }
+    }
+
+    // table at most half full, so probe chains stay short
+    uint32_t capacity = 16;
+    while (capacity < entries.size() * 2) capacity *= 2;
+    vector<uint32_t> slots(capacity, 0);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        ConfigKey whole(nodes[i].key);
+        uint32_t slot = static_cast<uint32_t>(hash_parts(&whole, 1)) & (capacity - 1);
+        while (slots[slot] != 0) slot = (slot + 1) & (capacity - 1);
+        slots[slot] = static_cast<uint32_t>(i + 1);
+    }
+
+    Header h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, SNAPSHOT_MAGIC, sizeof(h.magic));
+    h.format = SNAPSHOT_FORMAT;
+    h.entryCount = static_cast<uint32_t>(entries.size());
+    h.slotCount = capacity;
+    h.bitWords = static_cast<uint32_t>(bits.size());
+    h.sourceTime = sourceTime;
+    h.sourceSize = sourceSize;
+    h.sourceHash = hash_bytes(FNV_OFFSET, text.data(), text.size());
+    h.paletteHash = paletteHash;
+    h.stringBytes = static_cast<uint32_t>(strings.size());
+
+    // the JSON changed size between the stamp and the read: let the hash decide next time
+    if (text.size() != sourceSize) h.sourceTime = 0;
+
+    owned.resize(image_size(h.entryCount, h.slotCount, h.bitWords, h.stringBytes));
+    char* out = owned.data();
+    memcpy(out, &h, sizeof(h));
+    out += sizeof(h);
+    if (!entries.empty()) memcpy(out, entries.data(), entries.size() * sizeof(Entry));
+    out += entries.size() * sizeof(Entry);
+    memcpy(out, slots.data(), slots.size() * sizeof(uint32_t));
+    out += slots.size() * sizeof(uint32_t);
+    if (!bits.empty()) memcpy(out, bits.data(), bits.size() * sizeof(uint64_t));
+    out += bits.size() * sizeof(uint64_t);
+    if (!strings.empty()) memcpy(out, strings.data(), strings.size());
+
+    image = owned.data();
+}
+
+// -------------------- Snapshot --------------------
+
+// a snapshot is only trusted after every offset in it has been checked
+bool ConfigIndex::validate(const char* data, size_t size) const {
+    if (size < sizeof(Header)) return false;
+    const Header* h = header_of(data);
+    if (memcmp(h->magic, SNAPSHOT_MAGIC, sizeof(h->magic)) != 0) return false;
+    if (h->format != SNAPSHOT_FORMAT || h->paletteHash != paletteHash) return false;
+    if (h->slotCount < 16 || (h->slotCount & (h->slotCount - 1)) != 0) return false;
+    if (h->entryCount >= h->slotCount) return false;
+    if (image_size(h->entryCount, h->slotCount, h->bitWords, h->stringBytes) != size) return false;
+
+    const Entry* entries = entries_of(data);
+    for (uint32_t i = 0; i < h->entryCount; ++i) {
+        const Entry& e = entries[i];
+        if (e.keyOffset > h->stringBytes || e.keyLength > h->stringBytes - e.keyOffset) return false;
+        if (e.kind > Entry::Other) return false;
+        if (e.kind == Entry::String) {
+            if (e.textOffset > h->stringBytes || e.textLength > h->stringBytes - e.textOffset) return false;
+            if (e.color != NO_COLOR && e.color >= palette.size()) return false;
+        }
+        if (e.kind == Entry::Bool && e.bit / 64 >= h->bitWords) return false;
+    }
+    const uint32_t* slots = slots_of(data);
+    for (uint32_t i = 0; i < h->slotCount; ++i) {
+        if (slots[i] > h->entryCount) return false;
+    }
+    return true;
+}
+
+bool ConfigIndex::load(const string& jsonPath, bool reuse) {
+    size_t dot = jsonPath.find_last_of('.');
+    size_t slash = jsonPath.find_last_of("\\/");
+    bool hasExtension = dot != string::npos && (slash == string::npos || dot > slash);
+    snapshotPath = (hasExtension ? jsonPath.substr(0, dot) : jsonPath) + ".bin";
+
+    // stamp the JSON before anyone reads it: an edit made after this point
+    // gets a newer time and is picked up by the next run
+    if (!MappedFile::stamp(jsonPath, sourceTime, sourceSize)) {
+        sourceTime = sourceSize = 0;
+        return false;
+    }
+    if (!reuse) return false;
+
+    if (!snapshot.open(snapshotPath)) return false;
+    if (!validate(snapshot.data(), snapshot.size())) {
+        snapshot.close();
+        return false;
+    }
+
+    const Header* h = header_of(snapshot.data());
+    if (h->sourceTime != 0 && h->sourceTime == sourceTime && h->sourceSize == sourceSize) {
+        image = snapshot.data();
+        return true;
+    }
+
+    // touched but maybe not changed (copied back, checked out again...):
+    // compare the content instead, and re-stamp the snapshot if it matches
+    string text;
+    if (!read_file(jsonPath, text) || text.size() != sourceSize ||
+        hash_bytes(FNV_OFFSET, text.data(), text.size()) != h->sourceHash) {
+        snapshot.close();
+        return false;
+    }
+    owned.assign(snapshot.data(), snapshot.data() + snapshot.size());
+    snapshot.close();
+    Header* stamped = reinterpret_cast<Header*>(owned.data());
+    stamped->sourceTime = sourceTime;
+    stamped->sourceSize = sourceSize;
+    image = owned.data();
+    save();
+    return true;
+}
+
+bool ConfigIndex::save() const {
+    if (snapshotPath.empty() || !image || image != owned.data()) return false;
+    return MappedFile::replace(snapshotPath, owned.data(), owned.size());
+}
+// -------------------- Lookups --------------------
+
+const ConfigIndex::Entry* ConfigIndex::find(initializer_list<ConfigKey> path) const {
+    lookupCount.fetch_add(1, memory_order_relaxed);
+    if (!image) return nullptr;
+
+    const ConfigKey* parts = path.begin();
+    const uint32_t* slots = slots_of(image);
+    const Entry* entries = entries_of(image);
+    const char* strings = strings_of(image);
+    uint32_t slotCount = header_of(image)->slotCount;
+    size_t mask = slotCount - 1;
+    size_t slot = static_cast<size_t>(hash_parts(parts, path.size())) & mask;
+    for (uint32_t probes = 0; probes < slotCount && slots[slot] != 0; ++probes, slot = (slot + 1) & mask) {
+        const Entry& e = entries[slots[slot] - 1];
+        if (key_equals(strings + e.keyOffset, e.keyLength, parts, path.size())) return &e;
+    }
+    return nullptr;
+}
+
+bool ConfigIndex::has(initializer_list<ConfigKey> path) const {
+    return find(path) != nullptr;
+}
+
+bool ConfigIndex::flag(initializer_list<ConfigKey> path, bool fallback) const {
+    const Entry* e = find(path);
+    if (!e || e->kind != Entry::Bool) return fallback;
+    return (bits_of(image)[e->bit / 64] >> (e->bit % 64)) & 1;
+}
+
+double ConfigIndex::number(initializer_list<ConfigKey> path, double fallback) const {
+    const Entry* e = find(path);
+    return (e && e->kind == Entry::Number) ? e->number : fallback;
+}
+
+string ConfigIndex::text(initializer_list<ConfigKey> path, const string& fallback) const {
+    const Entry* e = find(path);
+    if (!e || e->kind != Entry::String) return fallback;
+    return string(strings_of(image) + e->textOffset, e->textLength);
+}
+
+const string& ConfigIndex::color(ConfigKey name) const {
+    const string* white = nullptr;
+    for (const auto& c : palette) {
+        if (c.first.size() == name.size && memcmp(c.first.data(), name.data, name.size) == 0) return c.second;
+        if (c.first == "white") white = &c.second;
+    }
+    static const string none;
+    return white ? *white : none;
+}
+
+const string& ConfigIndex::color(initializer_list<ConfigKey> path, ConfigKey fallback) const {
+    const Entry* e = find(path);
+    if (!e || e->kind != Entry::String || e->color == NO_COLOR) return color(fallback);
+    return palette[e->color].second;
+}
+
+vector<string> ConfigIndex::sections() const {
+    vector<string> list;
+    if (!image) return list;
+    const Header* h = header_of(image);
+    const Entry* entries = entries_of(image);
+    const char* strings = strings_of(image);
+    for (uint32_t i = 0; i < h->entryCount; ++i) {
+        const Entry& e = entries[i];
+        if (e.kind != Entry::Object) continue;
+        if (memchr(strings + e.keyOffset, '.', e.keyLength)) continue;
+        list.emplace_back(strings + e.keyOffset, e.keyLength);
+    }
+    return list;
+}
+
+size_t ConfigIndex::size() const {
+    return image ? header_of(image)->entryCount : 0;
+}
@@ -0,0 +1,824 @@
+#include "include/DiskBenchmark.h"
+#include <vector>
+#include <chrono>
+#include <mutex>
+#include <deque>
+#include <utility>
+#include <cstdint>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <winioctl.h>
+#include <malloc.h>
+#else
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
+#include <linux/io_uring.h>
+#endif
+
+using namespace std;
+using BenchClock = chrono::steady_clock;
+
+static const size_t SEQ_BLOCK = 1024 * 1024;  // 1 MiB
+static const size_t RAND_BLOCK = 4096;        // 4 KiB, also the O_DIRECT / NO_BUFFERING alignment
+static const int LARGE_FILE_VISITS = 4096;    // findLargeFile: directory entries looked at
+static const int LARGE_FILE_DEPTH = 3;        // ... and folder levels below each root
+
+// -------------------- Latency histogram --------------------
+
+// Completion latencies in nanoseconds: every power of two is split into 16
+// linear buckets, so a percentile is off by less than 1/16 whatever the scale
+// (ns on Optane, ms on a USB stick) and recording is one increment.
+class LatencyHistogram {
+public:
+    LatencyHistogram() : total(0) { memset(buckets, 0, sizeof(buckets)); }
+
+    void add(uint64_t ns) {
+        buckets[bucketOf(ns)]++;
+        total++;
+    }
+
+    uint64_t count() const { return total; }
+
+    // q in 0..1; middle of the bucket holding that rank
+    double percentileUs(double q) const {
+        if (total == 0) return 0.0;
+        uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(total - 1)) + 1;
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKETS; ++i) {
+            seen += buckets[i];
+            if (seen >= rank) return bucketMiddle(i) / 1000.0;
+        }
+        return bucketMiddle(BUCKETS - 1) / 1000.0;
+    }
+
+private:
+    static const int SUB = 16;                 // buckets per power of two
+    static const int BUCKETS = 61 * SUB;
+
+    uint64_t buckets[BUCKETS];
+    uint64_t total;
+
+    static int bucketOf(uint64_t ns) {
+        if (ns < SUB) return static_cast<int>(ns);
+        int msb = 4;
+        while (msb < 63 && (ns >> (msb + 1)) != 0) ++msb;
+        int shift = msb - 4;
+        return (shift + 1) * SUB + static_cast<int>((ns >> shift) & (SUB - 1));
+    }
+
+    static double bucketMiddle(int index) {
+        if (index < SUB) return index;
+        int shift = index / SUB - 1;
+        double low = static_cast<double>((static_cast<uint64_t>(SUB + index % SUB)) << shift);
+        return low + static_cast<double>(1ULL << shift) / 2.0;
+    }
+};
+
+// -------------------- One test --------------------
+
+// Offsets, the measured window and the results of one test. Every engine
+// loops the same way: next() an offset, do the I/O, complete() it.
+// Write tests draw from a byte budget and end early once it is spent.
+class TestRun {
+public:
+    TestRun(bool write, bool random, size_t block, uint64_t spanBytes, const BenchmarkOptions& options,
+        uint64_t* budget = nullptr)
+        : write(write), block(block), random(random),
+          blocks(spanBytes / block), budget(budget), taken(0), options(options)
+    {
+        if (blocks == 0) blocks = 1;
+        restart();
+    }
+
+    bool write;
+    size_t block;
+
+    // the sequential write also prepares the file for the reads: it goes on
+    // past the window until every block has been written once
+    void fillFile() { mustWrap = true; }
+
+    // start over (another engine after this one failed), budget refunded
+    void restart() {
+        if (budget) *budget += taken;
+        taken = 0;
+        cursor = 0;
+        wrapped = false;
+        seed = 0x9E3779B97F4A7C15ULL;
+        bytes = ops = completed = 0;
+        failed = outOfBudget = measuring = false;
+        latency = LatencyHistogram();
+        started = BenchClock::now();
+        measureFrom = started + chrono::milliseconds(options.warmupMs);
+        end = measureFrom + chrono::milliseconds(options.durationMs);
+        lastDone = started;
+    }
+
+    // false once the test is over
+    bool next(BenchClock::time_point now, uint64_t& offset) {
+        if (failed) return false;
+        if (now >= end && (!mustWrap || wrapped)) return false;
+        if (budget) {
+            if (*budget < block) {
+                outOfBudget = true;
+                return false;
+            }
+            *budget -= block;
+            taken += block;
+        }
+        if (random) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            offset = (seed % blocks) * block;
+        }
+        else {
+            offset = cursor * block;
+            if (++cursor == blocks) {
+                cursor = 0;
+                wrapped = true;
+            }
+        }
+        return true;
+    }
+
+    // completions inside the measured window are counted; the warm-up is
+    // counted too until the window starts, in case the budget never gets there
+    void complete(BenchClock::time_point submitted, BenchClock::time_point done, bool ok) {
+        if (!ok) {
+            failed = true;
+            return;
+        }
+        completed++;
+        if (done > end) return;
+        if (!measuring && done >= measureFrom) {
+            latency = LatencyHistogram();
+            bytes = ops = 0;
+            measuring = true;
+        }
+        latency.add(static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(done - submitted).count()));
+        bytes += block;
+        ops++;
+        lastDone = done;
+    }
+
+    BenchmarkResult result() const {
+        BenchmarkResult r;
+        // a budget that ran out cuts the window short - or, spent within the
+        // warm-up, leaves the whole short run as the window
+        double seconds = options.durationMs / 1000.0;
+        if (outOfBudget) seconds = chrono::duration<double>(lastDone - (measuring ? measureFrom : started)).count();
+        else if (!measuring) return r;
+        if (failed || ops == 0 || seconds <= 0.0) return r;
+        r.ok = true;
+        r.ops = ops;
+        r.mbps = bytes / (1024.0 * 1024.0) / seconds;
+        r.iops = ops / seconds;
+        r.p50Us = latency.percentileUs(0.50);
+        r.p99Us = latency.percentileUs(0.99);
+        r.p999Us = latency.percentileUs(0.999);
+        return r;
+    }
+
+    bool filled() const { return !failed && wrapped; }
+
+    // failed before a single request went through: the engine can't do it
+    bool unsupported() const { return failed && completed == 0; }
+
+private:
+    bool random;
+    uint64_t blocks;
+    uint64_t* budget;
+    uint64_t taken;
+    BenchmarkOptions options;
+    uint64_t cursor;
+    bool wrapped;
+    bool mustWrap = false;
+    uint64_t seed;
+
+    BenchClock::time_point started;
+    BenchClock::time_point measureFrom;
+    BenchClock::time_point end;
+    BenchClock::time_point lastDone;
+
+    LatencyHistogram latency;
+    uint64_t bytes;
+    uint64_t ops;
+    uint64_t completed;
+    bool failed;
+    bool outOfBudget;
+    bool measuring;                            // the window has started
+};
+
+// I/O buffers: one 1 MiB slot per request in flight, aligned for unbuffered
+// I/O and filled with noise so compressing controllers can't cheat on writes
+static char* alloc_buffers(size_t size) {
+#ifdef _WIN32
+    char* p = static_cast<char*>(_aligned_malloc(size, RAND_BLOCK));
+#else
+    void* raw = nullptr;
+    char* p = posix_memalign(&raw, RAND_BLOCK, size) == 0 ? static_cast<char*>(raw) : nullptr;
+#endif
+    if (!p) return nullptr;
+    uint64_t x = 0x2545F4914F6CDD1DULL;
+    for (size_t i = 0; i + sizeof(x) <= size; i += sizeof(x)) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        memcpy(p + i, &x, sizeof(x));
+    }
+    return p;
+}
+
+static void free_buffers(char* p) {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+// The tests, whatever the engine. On the scratch file: sequential write
+// (which also fills it), barrier, sequential + random read, random write.
+// On existing data (a block device, a large file): the two reads only.
+template <typename RunTest, typename Barrier>
+static void run_sequence(RunTest runTest, Barrier barrier, uint64_t span, bool scratch,
+    const BenchmarkOptions& options, DiskBenchmarkReport& report)
+{
+    // 3/4 of the write budget for the sequential write and the fill,
+    // the rest for the random write
+    uint64_t total = static_cast<uint64_t>(options.writeBudgetMb) * 1024 * 1024;
+    uint64_t seqBudget = total - total / 4;
+    uint64_t randBudget = total / 4;
+
+    if (scratch) {
+        TestRun seqWrite(true, false, SEQ_BLOCK, span, options, &seqBudget);
+        seqWrite.fillFile();
+        runTest(seqWrite);
+        report.seqWrite = seqWrite.result();
+        barrier();
+        if (!seqWrite.filled()) return;        // reads would hit holes
+    }
+
+    TestRun seqRead(false, false, SEQ_BLOCK, span, options);
+    runTest(seqRead);
+    report.seqRead = seqRead.result();
+
+    TestRun randRead(false, true, RAND_BLOCK, span, options);
+    runTest(randRead);
+    report.randRead = randRead.result();
+
+    if (scratch) {
+        TestRun randWrite(true, true, RAND_BLOCK, span, options, &randBudget);
+        runTest(randWrite);
+        report.randWrite = randWrite.result();
+    }
+}
+
+// scratch file size: file_mb, unless the budget can't even fill that
+static uint64_t scratch_span(const BenchmarkOptions& options) {
+    uint64_t span = static_cast<uint64_t>(options.fileMb > 0 ? options.fileMb : 1) * 1024 * 1024;
+    uint64_t seqBudget = static_cast<uint64_t>(options.writeBudgetMb) * 1024 * 1024 * 3 / 4;
+    if (span > seqBudget) span = seqBudget / SEQ_BLOCK * SEQ_BLOCK;
+    return span;
+}
+
+// a full volume is left alone: the scratch file never takes its last GiB
+static const uint64_t FREE_SPACE_RESERVE = 1024ULL * 1024 * 1024;
+
+#ifdef _WIN32
+// ============================================================
+// Windows: overlapped I/O on a completion port
+// ============================================================
+
+// <queueDepth> OVERLAPPED requests in flight; the port hands back whichever
+// finishes first and that slot is reissued at the next offset
+static void run_iocp(HANDLE file, HANDLE port, TestRun& test, char* buffers, unsigned depth) {
+    vector<OVERLAPPED> slots(depth);
+    vector<BenchClock::time_point> submitted(depth);
+    unsigned inFlight = 0;
+
+    auto issue = [&](unsigned i) -> bool {
+        uint64_t offset;
+        if (!test.next(BenchClock::now(), offset)) return false;
+        OVERLAPPED& ov = slots[i];
+        memset(&ov, 0, sizeof(ov));
+        ov.Offset = static_cast<DWORD>(offset);
+        ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        char* buf = buffers + static_cast<size_t>(i) * SEQ_BLOCK;
+        submitted[i] = BenchClock::now();
+        BOOL ok = test.write
+            ? WriteFile(file, buf, static_cast<DWORD>(test.block), NULL, &ov)
+            : ReadFile(file, buf, static_cast<DWORD>(test.block), NULL, &ov);
+        // a request finished on the spot is still queued on the port
+        if (!ok && GetLastError() != ERROR_IO_PENDING) {
+            test.complete(submitted[i], BenchClock::now(), false);
+            return false;
+        }
+        inFlight++;
+        return true;
+    };
+
+    for (unsigned i = 0; i < depth; ++i) {
+        if (!issue(i)) break;
+    }
+    while (inFlight > 0) {
+        DWORD transferred = 0;
+        ULONG_PTR key = 0;
+        LPOVERLAPPED done = NULL;
+        BOOL ok = GetQueuedCompletionStatus(port, &transferred, &key, &done, INFINITE);
+        if (!done) break;                       // the port itself failed
+        inFlight--;
+        unsigned i = static_cast<unsigned>(done - slots.data());
+        test.complete(submitted[i], BenchClock::now(), ok && transferred == test.block);
+        issue(i);
+    }
+}
+
+// the tests on an open NO_BUFFERING | OVERLAPPED handle
+static bool run_handle(HANDLE file, uint64_t span, bool scratch, const BenchmarkOptions& options, DiskBenchmarkReport& report) {
+    unsigned depth = options.queueDepth > 0 ? options.queueDepth : 1;
+    HANDLE port = CreateIoCompletionPort(file, NULL, 0, 1);
+    char* buffers = alloc_buffers(static_cast<size_t>(depth) * SEQ_BLOCK);
+    if (!port || !buffers) {
+        if (port) CloseHandle(port);
+        if (buffers) free_buffers(buffers);
+        return false;
+    }
+
+    report.engine = "iocp";
+    run_sequence([&](TestRun& test) { run_iocp(file, port, test, buffers, depth); },
+        // barrier: the drive's own write cache is flushed before anything is
+        // read back (NO_BUFFERING already keeps the file out of the OS cache)
+        [&] { FlushFileBuffers(file); },
+        span, scratch, options, report);
+
+    CloseHandle(port);
+    free_buffers(buffers);
+    report.ok = report.seqWrite.ok || report.seqRead.ok || report.randRead.ok || report.randWrite.ok;
+    return true;
+}
+
+bool DiskBenchmark::run(const string& directory, const BenchmarkOptions& options, DiskBenchmarkReport& report) {
+    report = DiskBenchmarkReport();
+    string path = directory;
+    if (!path.empty() && path.back() != '\\' && path.back() != '/') path += '\\';
+
+    uint64_t span = scratch_span(options);
+    ULARGE_INTEGER available, total, free;
+    if (span < SEQ_BLOCK || !GetDiskFreeSpaceExA(path.c_str(), &available, &total, &free) ||
+        available.QuadPart < span + FREE_SPACE_RESERVE) return false;
+    path += "binaryfetch_bench.tmp";
+
+    // no cache, no lazy writer; the file goes away with the handle - also
+    // when the process is killed by Ctrl+C or Task Manager
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+        FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_NO_BUFFERING | FILE_FLAG_WRITE_THROUGH |
+        FILE_FLAG_OVERLAPPED | FILE_FLAG_DELETE_ON_CLOSE, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    // size the file up front so no write has to extend it
+    LARGE_INTEGER size;
+    size.QuadPart = static_cast<LONGLONG>(span);
+    bool ran = SetFilePointerEx(file, size, NULL, FILE_BEGIN) && SetEndOfFile(file) &&
+        run_handle(file, span, true, options, report);
+    CloseHandle(file);
+    if (ran) report.source = "scratch file";
+    return ran;
+}
+
+bool DiskBenchmark::runReadOnly(const string& path, const BenchmarkOptions& options, DiskBenchmarkReport& report) {
+    report = DiskBenchmarkReport();
+    // \\.\PhysicalDriveN needs an elevated prompt; plain files don't
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        NULL, OPEN_EXISTING, FILE_FLAG_NO_BUFFERING | FILE_FLAG_OVERLAPPED, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    uint64_t size = 0;
+    LARGE_INTEGER fileSize;
+    GET_LENGTH_INFORMATION length;
+    DWORD returned = 0;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) size = static_cast<uint64_t>(fileSize.QuadPart);
+    else if (DeviceIoControl(file, IOCTL_DISK_GET_LENGTH_INFO, NULL, 0, &length, sizeof(length), &returned, NULL)) {
+        size = static_cast<uint64_t>(length.Length.QuadPart);
+    }
+
+    uint64_t span = size / SEQ_BLOCK * SEQ_BLOCK;
+    bool ran = span >= SEQ_BLOCK && run_handle(file, span, false, options, report);
+    CloseHandle(file);
+    if (ran) report.source = path;
+    return ran;
+}
+
+// the file opens the way runReadOnly() opens it (pagefile.sys and other
+// files held open exclusively don't)
+static bool can_read_unbuffered(const string& path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        NULL, OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    CloseHandle(file);
+    return true;
+}
+
+string DiskBenchmark::findLargeFile(const vector<string>& directories, unsigned long long minBytes) {
+    // breadth first, a few thousand entries at most; junctions and sparse
+    // files are skipped (a hole is "read" without touching the disk), and so
+    // are system files: the largest ones on C:\ are the locked page /
+    // hibernation / swap files
+    string best;
+    unsigned long long bestSize = 0;
+    int visits = LARGE_FILE_VISITS;
+    for (const string& root : directories) {
+        deque<pair<string, int>> pending = { { root, 0 } };
+        while (!pending.empty() && visits > 0) {
+            string dir = pending.front().first;
+            int depth = pending.front().second;
+            pending.pop_front();
+            if (!dir.empty() && dir.back() != '\\') dir += '\\';
+
+            WIN32_FIND_DATAA entry;
+            HANDLE find = FindFirstFileA((dir + "*").c_str(), &entry);
+            if (find == INVALID_HANDLE_VALUE) continue;
+            do {
+                if (--visits <= 0) break;
+                string name = entry.cFileName;
+                if (name == "." || name == ".." || (entry.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)) continue;
+                if (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+                    if (depth < LARGE_FILE_DEPTH) pending.push_back({ dir + name, depth + 1 });
+                    continue;
+                }
+                if (entry.dwFileAttributes & (FILE_ATTRIBUTE_SPARSE_FILE | FILE_ATTRIBUTE_COMPRESSED |
+                    FILE_ATTRIBUTE_OFFLINE | FILE_ATTRIBUTE_SYSTEM)) continue;
+                unsigned long long size = (static_cast<unsigned long long>(entry.nFileSizeHigh) << 32) | entry.nFileSizeLow;
+                if (size >= minBytes && size > bestSize && can_read_unbuffered(dir + name)) {
+                    best = dir + name;
+                    bestSize = size;
+                }
+            } while (FindNextFileA(find, &entry));
+            FindClose(find);
+        }
+        if (!best.empty()) break;
+    }
+    return best;
+}
+
+#else
+// ============================================================
+// Linux: O_DIRECT + io_uring, pread / pwrite threads as fallback
+// ============================================================
+
+// The submission and completion rings, mapped straight from the kernel
+// (the part of liburing we need, without the dependency)
+struct Uring {
+    int fd = -1;
+    void* sqRing = MAP_FAILED;
+    size_t sqRingSize = 0;
+    void* cqRing = MAP_FAILED;
+    size_t cqRingSize = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqesSize = 0;
+
+    unsigned* sqTail = nullptr;
+    unsigned* sqMask = nullptr;
+    unsigned* sqArray = nullptr;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned* cqMask = nullptr;
+    io_uring_cqe* cqes = nullptr;
+    unsigned pending = 0;                      // queued, not submitted yet
+
+    bool open(unsigned entries) {
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0) return false;
+
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        cqRing = mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        sqes = static_cast<io_uring_sqe*>(mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+        if (sqRing == MAP_FAILED || cqRing == MAP_FAILED || sqes == MAP_FAILED) {
+            close();
+            return false;
+        }
+
+        char* sq = static_cast<char*>(sqRing);
+        char* cq = static_cast<char*>(cqRing);
+        sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return true;
+    }
+
+    void close() {
+        if (sqes != MAP_FAILED) munmap(sqes, sqesSize);
+        if (cqRing != MAP_FAILED) munmap(cqRing, cqRingSize);
+        if (sqRing != MAP_FAILED) munmap(sqRing, sqRingSize);
+        if (fd >= 0) ::close(fd);
+        fd = -1;
+        sqRing = cqRing = MAP_FAILED;
+        sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    }
+
+    // never more in flight than entries, so the ring can't be full
+    void queue(int file, bool write, char* buf, size_t size, uint64_t offset, uint64_t tag) {
+        unsigned tail = *sqTail;
+        unsigned index = tail & *sqMask;
+        io_uring_sqe& sqe = sqes[index];
+        memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = write ? IORING_OP_WRITE : IORING_OP_READ;
+        sqe.fd = file;
+        sqe.addr = reinterpret_cast<uint64_t>(buf);
+        sqe.len = static_cast<unsigned>(size);
+        sqe.off = offset;
+        sqe.user_data = tag;
+        sqArray[index] = index;
+        __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+        pending++;
+    }
+
+    // submit what was queued and wait for at least one completion
+    bool submitAndWait() {
+        while (true) {
+            long r = syscall(__NR_io_uring_enter, fd, pending, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (r >= 0) {
+                pending -= static_cast<unsigned>(r);
+                return true;
+            }
+            if (errno != EINTR) return false;
+        }
+    }
+
+    bool pop(io_uring_cqe& out) {
+        unsigned head = *cqHead;
+        if (head == __atomic_load_n(cqTail, __ATOMIC_ACQUIRE)) return false;
+        out = cqes[head & *cqMask];
+        __atomic_store_n(cqHead, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+};
+
+static void run_uring(Uring& ring, int file, TestRun& test, char* buffers, unsigned depth) {
+    vector<BenchClock::time_point> submitted(depth);
+    unsigned inFlight = 0;
+
+    auto issue = [&](unsigned i) {
+        uint64_t offset;
+        if (!test.next(BenchClock::now(), offset)) return;
+        submitted[i] = BenchClock::now();
+        ring.queue(file, test.write, buffers + static_cast<size_t>(i) * SEQ_BLOCK, test.block, offset, i);
+        inFlight++;
+    };
+
+    for (unsigned i = 0; i < depth; ++i) issue(i);
+    while (inFlight > 0) {
+        if (!ring.submitAndWait()) {
+            test.complete(BenchClock::now(), BenchClock::now(), false);
+            return;
+        }
+        io_uring_cqe cqe;
+        while (ring.pop(cqe)) {
+            inFlight--;
+            unsigned i = static_cast<unsigned>(cqe.user_data);
+            test.complete(submitted[i], BenchClock::now(), cqe.res == static_cast<int>(test.block));
+            issue(i);
+        }
+    }
+}
+
+// one blocking pread / pwrite loop per queue slot
+static void run_threads(int file, TestRun& test, char* buffers, unsigned depth) {
+    mutex m;
+    vector<thread> workers;
+    for (unsigned i = 0; i < depth; ++i) {
+        workers.emplace_back([&, i] {
+            char* buf = buffers + static_cast<size_t>(i) * SEQ_BLOCK;
+            while (true) {
+                uint64_t offset;
+                {
+                    lock_guard<mutex> lock(m);
+                    if (!test.next(BenchClock::now(), offset)) return;
+                }
+                auto start = BenchClock::now();
+                ssize_t n = test.write
+                    ? pwrite(file, buf, test.block, static_cast<off_t>(offset))
+                    : pread(file, buf, test.block, static_cast<off_t>(offset));
+                auto done = BenchClock::now();
+                lock_guard<mutex> lock(m);
+                test.complete(start, done, n == static_cast<ssize_t>(test.block));
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+}
+
+// the tests on an open O_DIRECT descriptor
+static bool run_fd(int file, uint64_t span, bool scratch, const BenchmarkOptions& options, DiskBenchmarkReport& report) {
+    unsigned depth = options.queueDepth > 0 ? options.queueDepth : 1;
+    char* buffers = alloc_buffers(static_cast<size_t>(depth) * SEQ_BLOCK);
+    if (!buffers) return false;
+
+    Uring ring;
+    bool uring = ring.open(depth);
+    report.engine = uring ? "io_uring" : "threads";
+    auto runTest = [&](TestRun& test) {
+        if (uring) {
+            run_uring(ring, file, test, buffers, depth);
+            if (!test.unsupported()) return;
+            // kernels before 5.6 have the ring but not IORING_OP_READ / WRITE
+            ring.close();
+            uring = false;
+            report.engine = "threads";
+            test.restart();
+        }
+        run_threads(file, test, buffers, depth);
+    };
+    // barrier: the drive's write cache is flushed and any page a filesystem
+    // without real O_DIRECT kept is dropped, so the reads come from the media
+    auto barrier = [&] {
+        fdatasync(file);
+        posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+    };
+    run_sequence(runTest, barrier, span, scratch, options, report);
+
+    if (uring) ring.close();
+    free_buffers(buffers);
+    report.ok = report.seqWrite.ok || report.seqRead.ok || report.randRead.ok || report.randWrite.ok;
+    return true;
+}
+
+bool DiskBenchmark::run(const string& directory, const BenchmarkOptions& options, DiskBenchmarkReport& report) {
+    report = DiskBenchmarkReport();
+    uint64_t span = scratch_span(options);
+    struct statvfs fs;
+    if (span < SEQ_BLOCK || statvfs(directory.c_str(), &fs) != 0 ||
+        static_cast<uint64_t>(fs.f_bavail) * fs.f_frsize < span + FREE_SPACE_RESERVE) return false;
+
+    string path = directory;
+    if (!path.empty() && path.back() != '/') path += '/';
+    path += ".binaryfetch_bench.tmp";
+
+    // O_DIRECT fails on filesystems without it (tmpfs, some FUSE): no result
+    int file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_DIRECT | O_CLOEXEC, 0600);
+    if (file < 0) return false;
+    // unlinked right away: the blocks go back as soon as the descriptor is
+    // closed, however the process ends (Ctrl+C, kill -9, a crash)
+    unlink(path.c_str());
+
+    bool ran = run_fd(file, span, true, options, report);
+    ::close(file);
+    if (ran) report.source = "scratch file";
+    return ran;
+}
+
+bool DiskBenchmark::runReadOnly(const string& path, const BenchmarkOptions& options, DiskBenchmarkReport& report) {
+    report = DiskBenchmarkReport();
+    // /dev/<disk> usually needs root or the "disk" group; plain files don't
+    int file = ::open(path.c_str(), O_RDONLY | O_DIRECT | O_CLOEXEC);
+    if (file < 0) return false;
+
+    uint64_t size = 0;
+    struct stat st;
+    if (fstat(file, &st) == 0) {
+        if (S_ISBLK(st.st_mode)) {
+            unsigned long long bytes = 0;
+            if (ioctl(file, BLKGETSIZE64, &bytes) == 0) size = bytes;
+        }
+        else if (S_ISREG(st.st_mode)) {
+            size = static_cast<uint64_t>(st.st_size);
+        }
+    }
+
+    uint64_t span = size / SEQ_BLOCK * SEQ_BLOCK;
+    bool ran = span >= SEQ_BLOCK && run_fd(file, span, false, options, report);
+    ::close(file);
+    if (ran) report.source = path;
+    return ran;
+}
+
+string DiskBenchmark::findLargeFile(const vector<string>& directories, unsigned long long minBytes) {
+    // breadth first, a few thousand entries at most, never leaving the
+    // filesystem; sparse files are skipped (a hole is "read" without
+    // touching the disk)
+    string best;
+    unsigned long long bestSize = 0;
+    int visits = LARGE_FILE_VISITS;
+    for (const string& root : directories) {
+        struct stat rootSt;
+        if (stat(root.c_str(), &rootSt) != 0) continue;
+        deque<pair<string, int>> pending = { { root, 0 } };
+        while (!pending.empty() && visits > 0) {
+            string dir = pending.front().first;
+            int depth = pending.front().second;
+            pending.pop_front();
+            if (!dir.empty() && dir.back() != '/') dir += '/';
+
+            DIR* d = opendir(dir.c_str());
+            if (!d) continue;
+            while (dirent* entry = readdir(d)) {
+                if (--visits <= 0) break;
+                string name = entry->d_name;
+                if (name == "." || name == "..") continue;
+                string path = dir + name;
+                struct stat st;
+                if (lstat(path.c_str(), &st) != 0 || st.st_dev != rootSt.st_dev) continue;
+                if (S_ISDIR(st.st_mode)) {
+                    if (depth < LARGE_FILE_DEPTH) pending.push_back({ path, depth + 1 });
+                    continue;
+                }
+                unsigned long long size = static_cast<unsigned long long>(st.st_size);
+                bool dense = static_cast<unsigned long long>(st.st_blocks) * 512 >= size;
+                if (S_ISREG(st.st_mode) && dense && size >= minBytes && size > bestSize && access(path.c_str(), R_OK) == 0) {
+                    best = path;
+                    bestSize = size;
+                }
+            }
+            closedir(d);
+        }
+        if (!best.empty()) break;
+    }
+    return best;
+}
+
+#endif
+
+// -------------------- DiskBenchmarkBatch --------------------
+
+DiskBenchmarkBatch::~DiskBenchmarkBatch() {
+    for (auto& worker : workers) worker.join();
+}
+
+void DiskBenchmarkBatch::add(const string& device, const vector<string>& directories, const string& node) {
+    unique_ptr<Job>& job = jobs[device];
+    if (!job) {
+        job.reset(new Job());
+        order.push_back(job.get());
+    }
+    job->directories.insert(job->directories.end(), directories.begin(), directories.end());
+    if (job->node.empty()) job->node = node;
+}
+
+void DiskBenchmarkBatch::start() {
+    // at most parallelDevices disks at a time, taken in the order they were added
+    size_t count = options.parallelDevices > 0 ? options.parallelDevices : 1;
+    if (count > order.size()) count = order.size();
+    for (size_t i = 0; i < count; ++i) {
+        workers.emplace_back([this] { work(); });
+    }
+}
+
+void DiskBenchmarkBatch::work() {
+    while (true) {
+        Job* job;
+        {
+            lock_guard<mutex> lock(m);
+            if (next == order.size()) return;
+            job = order[next++];
+        }
+
+        DiskBenchmarkReport report;
+        // writing only when asked to; a volume that can't take the
+        // scratch file is still measured read-only
+        if (options.write) {
+            for (const string& dir : job->directories) {
+                if (DiskBenchmark::run(dir, options, report) && report.ok) break;
+            }
+        }
+        if (!report.ok && !job->node.empty()) DiskBenchmark::runReadOnly(job->node, options, report);
+        if (!report.ok) {
+            string file = DiskBenchmark::findLargeFile(job->directories, static_cast<unsigned long long>(options.fileMb) * 1024 * 1024);
+            if (!file.empty()) DiskBenchmark::runReadOnly(file, options, report);
+        }
+
+        lock_guard<mutex> lock(m);
+        job->report = report;
+        job->done = true;
+        finished.notify_all();
+    }
+}
+
+const DiskBenchmarkReport& DiskBenchmarkBatch::wait(const string& device) {
+    static const DiskBenchmarkReport none;
+    auto it = jobs.find(device);
+    if (it == jobs.end()) return none;
+    Job* job = it->second.get();
+    unique_lock<mutex> lock(m);
+    finished.wait(lock, [job] { return job->done; });
+    return job->report;
+}
@@ -1,10 +1,13 @@
-#include "include\DisplayInfo.h"
+#include "include/DisplayInfo.h"
 
+// DXGI / registry on Windows; the Linux side (DRM sysfs) is in DisplayInfoLinux.cpp
+#ifdef _WIN32
 #include <windows.h>
 #include <dxgi1_6.h>
 #include <ShellScalingApi.h>
 #include <SetupApi.h>
 #include <cfgmgr32.h>
+#endif
 #include <string>
 #include <vector>
 #include <cmath>
@@ -13,13 +16,16 @@
 #include <cwctype>
 using namespace std;
 
+#ifdef _WIN32
 #pragma comment(lib, "dxgi.lib")
 #pragma comment(lib, "Shcore.lib")
 #pragma comment(lib, "SetupAPI.lib")
 #pragma comment(lib, "cfgmgr32.lib")
+#endif
 
 // ----------------- Utilities (mirrors CompactScreen) -----------------
 
+#ifdef _WIN32
 string DisplayInfo::WideToUtf8(const wchar_t* w) {
     if (!w) return {};
     int len = WideCharToMultiByte(CP_UTF8, 0, w, -1, nullptr, 0, nullptr, nullptr);
@@ -29,6 +35,7 @@ string DisplayInfo::WideToUtf8(const wchar_t* w) {
     if (!s.empty() && s.back() == '\0') s.pop_back();
     return s;
 }
+#endif
 
 string DisplayInfo::scaleMultiplier(int scalePercent) {
     float mul = scalePercent / 100.0f;
@@ -76,6 +83,7 @@ string DisplayInfo::computeAspectRatio(int w, int h) {
     return to_string(aw) + ":" + to_string(ah);
 }
 
+#ifdef _WIN32
 bool DisplayInfo::isNvidiaPresent() {
     DISPLAY_DEVICEW dd{};
     dd.cb = sizeof(dd);
@@ -97,6 +105,7 @@ bool DisplayInfo::isAMDPresent() {
     }
     return false;
 }
+#endif
 
 // ----------------- EDID parsing (kept same logic) -----------------
 
@@ -137,6 +146,7 @@ DisplayInfo::EDIDInfo DisplayInfo::parseEDID(const unsigned char* edid, size_t s
     return info;
 }
 
+#ifdef _WIN32
 string DisplayInfo::getFriendlyNameFromEDID(const wstring& deviceName) {
     // Preserve CompactScreen registry scanning logic to obtain friendly name
     wstring monitorHardwareId;
@@ -255,6 +265,7 @@ string DisplayInfo::getFriendlyNameFromEDID(const wstring& deviceName) {
     RegCloseKey(hKeyMonitors);
     return friendlyName;
 }
+#endif
 
 // ----------------- Core DXGI population (kept intact, extended) -----------------
 
@@ -264,9 +275,13 @@ DisplayInfo::DisplayInfo() {
 
 bool DisplayInfo::refresh() {
     screens.clear();
+#ifdef _WIN32
     if (!populateFromDXGI()) return false;
     enrichWithNVAPI();
     enrichWithADL();
+#else
+    if (!populateFromDRM()) return false;
+#endif
     return !screens.empty();
 }
 
@@ -274,6 +289,7 @@ const vector<DisplayInfo::ScreenInfo>& DisplayInfo::getScreens() const {
     return screens;
 }
 
+#ifdef _WIN32
 bool DisplayInfo::populateFromDXGI() {
     IDXGIFactory1* factory = nullptr;
     if (FAILED(CreateDXGIFactory1(IID_PPV_ARGS(&factory)))) return false;
@@ -534,3 +550,5 @@ bool DisplayInfo::enrichWithADL() {
 #endif
     return true;
 }
+
+#endif // _WIN32
@@ -0,0 +1,64 @@
+#include "include/DisplayInfo.h"
+
+// Linux side of DisplayInfo: connected DRM connectors and their raw EDID,
+// fed to the same parseEDID() the Windows registry scan uses. There is no
+// desktop to ask, so the applied mode is the connector's preferred mode
+// and scaling / DSR / VSR stay at their neutral values.
+#ifndef _WIN32
+#include "include/LinuxDrm.h"
+
+#include <cstdio>
+using namespace std;
+
+bool DisplayInfo::populateFromDRM() {
+    for (const auto& out : drm_connected_outputs()) {
+        EDIDInfo edidInfo = parseEDID(out.edid.data(), out.edid.size());
+
+        // ===== APPLIED MODE (preferred mode, listed first) =====
+        int currentW = 0, currentH = 0;
+        if (!out.modes.empty()) {
+            currentW = out.modes[0].first;
+            currentH = out.modes[0].second;
+        }
+
+        // ===== NATIVE PANEL RESOLUTION (FROM EDID) =====
+        int nativeW = edidInfo.valid ? edidInfo.nativeWidth : 0;
+        int nativeH = edidInfo.valid ? edidInfo.nativeHeight : 0;
+        if (nativeW <= 0 || nativeH <= 0) {
+            nativeW = currentW;
+            nativeH = currentH;
+        }
+        if (currentW <= 0 || currentH <= 0) {
+            currentW = nativeW;
+            currentH = nativeH;
+        }
+
+        int refresh = drm_edid_refresh_rate(out.edid.data(), out.edid.size());
+        if (refresh <= 1) refresh = 60;
+
+        ScreenInfo info;
+        info.name = !edidInfo.friendlyName.empty() ? edidInfo.friendlyName : out.connector;
+
+        info.native_width = nativeW;
+        info.native_height = nativeH;
+        info.native_resolution = to_string(nativeW) + "x" + to_string(nativeH);
+
+        info.current_width = currentW;
+        info.current_height = currentH;
+        info.refresh_rate = refresh;
+
+        info.scale_percent = 100;
+        info.scale_mul = scaleMultiplier(100);
+        int upscaleFactor = computeUpscaleFactor(currentW, nativeW);
+        info.upscale = to_string(upscaleFactor) + "x";
+
+        info.aspect_ratio = computeAspectRatio(currentW, currentH);
+        info.dsr_enabled = false;
+        info.dsr_type = "None";
+
+        screens.push_back(info);
+    }
+    return !screens.empty();
+}
+
+#endif
@@ -1,4 +1,5 @@
-﻿#include "include\DetailedGPUInfo.h"
+﻿#include "include/DetailedGPUInfo.h"
+#include "include/FactStore.h"
 #include <windows.h> // The base library for Windows development. It provides the core API for memory management and hardware interaction.
 #include <dxgi.h> // DirectX Graphics Infrastructure. Used to enumerate physical adapters (GPUs), check video memory capacity, and identify monitor outputs.
 #include <vector> // Standard C++ library for using the vector container.
@@ -139,38 +140,38 @@ static float get_nvapi_gpu_frequency(NvPhysicalGpuHandle handle)
 }
 
 // Helper: Estimate frequency for non-NVIDIA GPUs (basic method)
-static float estimate_gpu_frequency_basic(const wstring& gpuName)
+static float estimate_gpu_frequency_basic(const string& gpuName)
 {
     // Basic estimation based on common GPU models
     // This is a fallback and won't be very accurate
 
-    wstring name = gpuName;
+    string name = gpuName;
     // Convert to lowercase for comparison
-    transform(name.begin(), name.end(), name.begin(), ::towlower);
+    transform(name.begin(), name.end(), name.begin(), ::tolower);
 
     // I don't have amd gpu rn...so I'm using this cheap method for estimation
     // sorry gng :)
 
 
     // AMD GPUs - rough estimates
-    if (name.find(L"rx 7900") != wstring::npos) return 2.5f;
-    if (name.find(L"rx 7800") != wstring::npos) return 2.4f;
-    if (name.find(L"rx 7700") != wstring::npos) return 2.3f;
-    if (name.find(L"rx 6900") != wstring::npos) return 2.25f;
-    if (name.find(L"rx 6800") != wstring::npos) return 2.1f;
-    if (name.find(L"rx 6700") != wstring::npos) return 2.4f;
+    if (name.find("rx 7900") != string::npos) return 2.5f;
+    if (name.find("rx 7800") != string::npos) return 2.4f;
+    if (name.find("rx 7700") != string::npos) return 2.3f;
+    if (name.find("rx 6900") != string::npos) return 2.25f;
+    if (name.find("rx 6800") != string::npos) return 2.1f;
+    if (name.find("rx 6700") != string::npos) return 2.4f;
 
     // Intel Arc GPUs
 
     // I'm broke....I don't have any arc gpus too....
-    if (name.find(L"arc a770") != wstring::npos) return 2.4f;
-    if (name.find(L"arc a750") != wstring::npos) return 2.35f;
-    if (name.find(L"arc a580") != wstring::npos) return 2.0f;
+    if (name.find("arc a770") != string::npos) return 2.4f;
+    if (name.find("arc a750") != string::npos) return 2.35f;
+    if (name.find("arc a580") != string::npos) return 2.0f;
 
     // Intel Integrated GPUs
-    if (name.find(L"intel") != wstring::npos && name.find(L"iris") != wstring::npos)
+    if (name.find("intel") != string::npos && name.find("iris") != string::npos)
         return 1.3f;
-    if (name.find(L"intel") != wstring::npos && name.find(L"uhd") != wstring::npos)
+    if (name.find("intel") != string::npos && name.find("uhd") != string::npos)
         return 1.15f;
 
     // Default fallback
@@ -181,8 +182,9 @@ vector<GPUData> DetailedGPUInfo::get_all_gpus()
 {
     vector<GPUData> gpus;
 
-    IDXGIFactory* pFactory = nullptr;
-    if (FAILED(CreateDXGIFactory(__uuidof(IDXGIFactory), (void**)&pFactory))) {
+    // DXGI adapter list is enumerated once per run and shared with the other GPU modules
+    vector<GpuAdapter> adapters = FactStore::gpuAdapters();
+    if (adapters.empty()) {
         return gpus;
     }
 
@@ -205,27 +207,21 @@ vector<GPUData> DetailedGPUInfo::get_all_gpus()
         }
     }
 
-    UINT i = 0;
     UINT nvidiaAdapterIndex = 0; // Separate counter for NVIDIA GPUs
-    IDXGIAdapter* pAdapter = nullptr;
 
-    while (pFactory->EnumAdapters(i, &pAdapter) != DXGI_ERROR_NOT_FOUND)
+    for (size_t i = 0; i < adapters.size(); i++)
     {
-        DXGI_ADAPTER_DESC desc;
-        pAdapter->GetDesc(&desc);
+        const GpuAdapter& adapter = adapters[i];
 
         GPUData gpu;
-        gpu.index = i;
-
-        // Convert wide string to string
-        wstring ws(desc.Description);
-        gpu.name = string(ws.begin(), ws.end());
-        gpu.vram_gb = static_cast<float>(desc.DedicatedVideoMemory) / (1024.0f * 1024.0f * 1024.0f);
+        gpu.index = static_cast<int>(i);
+        gpu.name = adapter.name;
+        gpu.vram_gb = static_cast<float>(adapter.vramBytes) / (1024.0f * 1024.0f * 1024.0f);
 
         // Get frequency based on GPU vendor
         gpu.frequency_ghz = 0.0f;
 
-        if (is_nvidia_gpu(desc.VendorId) && nvapiInitialized && nvidiaAdapterIndex < nvapiGpuCount)
+        if (is_nvidia_gpu(adapter.vendorId) && nvapiInitialized && nvidiaAdapterIndex < nvapiGpuCount)
         {
             // NVIDIA GPU - use NVAPI
             NvPhysicalGpuHandle handle = nvapiHandles[nvidiaAdapterIndex];
@@ -235,12 +231,10 @@ vector<GPUData> DetailedGPUInfo::get_all_gpus()
         else
         {
             // Non-NVIDIA GPU or NVAPI not available - use basic estimation
-            gpu.frequency_ghz = estimate_gpu_frequency_basic(ws);
+            gpu.frequency_ghz = estimate_gpu_frequency_basic(adapter.name);
         }
 
         gpus.push_back(gpu);
-        pAdapter->Release();
-        i++;
     }
 
     // Clean up NVAPI
@@ -249,7 +243,6 @@ vector<GPUData> DetailedGPUInfo::get_all_gpus()
         NvAPI_Unload();
     }
 
-    if (pFactory) pFactory->Release();
     return gpus;
 }
 
@@ -289,6 +282,8 @@ STEP 1: DXGI FACTORY CREATION (ENTRY POINT)
 - CreateDXGIFactory() creates a DXGI Factory object.
 - This factory acts as the gateway to the graphics subsystem.
 - Through it, we can enumerate all physical graphics adapters (GPUs).
+- Steps 1 and 2 actually live in FactStore.cpp: the adapter list is
+  fetched once per run and shared by GPUInfo, DetailedGPUInfo and CompactGPU.
 
 DXGI is vendor-agnostic, meaning:
 ✔ Works for NVIDIA
@@ -1,4 +1,4 @@
-#include "include\ExtraInfo.h"
+#include "include/ExtraInfo.h"
 #include <windows.h>
 #include <mmdeviceapi.h>
 #include <functiondiscoverykeys_devpkey.h>
@@ -15,8 +15,9 @@ vector<AudioDevice> ExtraInfo::get_output_devices()
     vector<AudioDevice> devices;
     HRESULT hr;
 
-    // Initialize COM library for current thread
-    CoInitialize(nullptr);
+    // Initialize COM library for current thread (fails with RPC_E_CHANGED_MODE
+    // on a thread already in the multithreaded apartment - nothing to undo then)
+    bool needsUninit = SUCCEEDED(CoInitialize(nullptr));
 
     // Pointers for device enumeration
     IMMDeviceEnumerator* pEnum = nullptr;
@@ -27,7 +28,7 @@ vector<AudioDevice> ExtraInfo::get_output_devices()
         __uuidof(IMMDeviceEnumerator), (void**)&pEnum);
     if (FAILED(hr))
     {
-        CoUninitialize();
+        if (needsUninit) CoUninitialize();
         return devices;
     }
 
@@ -102,7 +103,7 @@ vector<AudioDevice> ExtraInfo::get_output_devices()
 
     // Release enumerator and uninitialize COM
     if (pEnum) pEnum->Release();
-    CoUninitialize();
+    if (needsUninit) CoUninitialize();
 
     return devices;
 }
@@ -116,8 +117,9 @@ vector<AudioDevice> ExtraInfo::get_input_devices()
     vector<AudioDevice> devices;
     HRESULT hr;
 
-    // Initialize COM library for current thread
-    CoInitialize(nullptr);
+    // Initialize COM library for current thread (fails with RPC_E_CHANGED_MODE
+    // on a thread already in the multithreaded apartment - nothing to undo then)
+    bool needsUninit = SUCCEEDED(CoInitialize(nullptr));
 
     // Pointers for device enumeration
     IMMDeviceEnumerator* pEnum = nullptr;
@@ -128,7 +130,7 @@ vector<AudioDevice> ExtraInfo::get_input_devices()
         __uuidof(IMMDeviceEnumerator), (void**)&pEnum);
     if (FAILED(hr))
     {
-        CoUninitialize();
+        if (needsUninit) CoUninitialize();
         return devices;
     }
 
@@ -203,7 +205,7 @@ vector<AudioDevice> ExtraInfo::get_input_devices()
 
     // Release enumerator and uninitialize COM
     if (pEnum) pEnum->Release();
-    CoUninitialize();
+    if (needsUninit) CoUninitialize();
 
     return devices;
 }
@@ -321,7 +323,7 @@ FUNCTION REFERENCE:
 
 17. CoUninitialize()
     - Closes COM library for current thread
-    - Must be called after CoInitialize()
+    - Only after a CoInitialize() that succeeded (S_OK / S_FALSE)
 
 18. GetSystemPowerStatus(LPSYSTEM_POWER_STATUS)
     - Retrieves system power status
@@ -0,0 +1,233 @@
+#include "include/FactStore.h"
+#include "include/StaticCache.h"
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <dxgi.h>
+#include <wlanapi.h>
+#include <sstream>
+#pragma comment(lib, "dxgi.lib")
+#pragma comment(lib, "wlanapi.lib")
+#else
+#include <time.h>
+#include <sys/socket.h>
+#include "include/LinuxNetlink.h"
+#include "include/LinuxDrm.h"
+#endif
+
+using namespace std;
+
+// -------------------- Store --------------------
+FactStore& FactStore::instance() {
+    static FactStore store;
+    return store;
+}
+
+const char* FactStore::name(FactId id) {
+    switch (id) {
+    case FactId::UptimeMs: return "uptime";
+    case FactId::GpuAdapters: return "gpu_adapters";
+    case FactId::WifiSsid: return "wifi_ssid";
+    case FactId::Network: return "network";
+    default: return "?";
+    }
+}
+
+void FactStore::expireVolatile() {
+    const FactId volatileFacts[] = { FactId::UptimeMs, FactId::WifiSsid, FactId::Network };
+    for (FactId id : volatileFacts) {
+        Entry& e = entries[static_cast<size_t>(id)];
+        lock_guard<mutex> lock(e.m);
+        e.value.reset();
+    }
+}
+
+// -------------------- Probes --------------------
+#ifdef _WIN32
+static string wide_to_utf8(const wchar_t* w) {
+    int sz = WideCharToMultiByte(CP_UTF8, 0, w, -1, nullptr, 0, nullptr, nullptr);
+    if (sz <= 1) return "";
+    string r(sz - 1, 0);
+    WideCharToMultiByte(CP_UTF8, 0, w, -1, &r[0], sz, nullptr, nullptr);
+    return r;
+}
+
+static unsigned long long probe_uptime_ms() {
+    return GetTickCount64();
+}
+
+// One DXGI walk for every GPU module
+static vector<GpuAdapter> probe_gpu_adapters() {
+    vector<GpuAdapter> list;
+
+    IDXGIFactory1* factory = nullptr;
+    if (FAILED(CreateDXGIFactory1(__uuidof(IDXGIFactory1), (void**)&factory)))
+        return list;
+
+    IDXGIAdapter1* adapter = nullptr;
+    for (UINT i = 0; factory->EnumAdapters1(i, &adapter) != DXGI_ERROR_NOT_FOUND; ++i) {
+        DXGI_ADAPTER_DESC1 desc{};
+        if (FAILED(adapter->GetDesc1(&desc))) {
+            adapter->Release();
+            continue;
+        }
+
+        GpuAdapter a;
+        a.name = wide_to_utf8(desc.Description);
+        a.vendorId = desc.VendorId;
+        a.vramBytes = static_cast<unsigned long long>(desc.DedicatedVideoMemory);
+
+        LARGE_INTEGER driverVersion{};
+        if (SUCCEEDED(adapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &driverVersion))) {
+            ostringstream oss;
+            oss << HIWORD(driverVersion.HighPart) << "."
+                << LOWORD(driverVersion.HighPart) << "."
+                << HIWORD(driverVersion.LowPart) << "."
+                << LOWORD(driverVersion.LowPart);
+            a.driverVersion = oss.str();
+        }
+        else {
+            a.driverVersion = "Unknown";
+        }
+
+        list.push_back(a);
+        adapter->Release();
+    }
+
+    factory->Release();
+    return list;
+}
+
+// SSID of the WLAN interface that is currently connected
+static string probe_wifi_ssid() {
+    HANDLE hClient = NULL;
+    DWORD dwCurVersion = 0;
+    if (WlanOpenHandle(2, NULL, &dwCurVersion, &hClient) != ERROR_SUCCESS)
+        return "";
+
+    PWLAN_INTERFACE_INFO_LIST pIfList = NULL;
+    if (WlanEnumInterfaces(hClient, NULL, &pIfList) != ERROR_SUCCESS) {
+        WlanCloseHandle(hClient, NULL);
+        return "";
+    }
+
+    string ssid;
+    for (DWORD i = 0; i < pIfList->dwNumberOfItems; ++i) {
+        PWLAN_CONNECTION_ATTRIBUTES pConnectInfo = NULL;
+        DWORD connectSize = sizeof(WLAN_CONNECTION_ATTRIBUTES);
+        WLAN_OPCODE_VALUE_TYPE opCode;
+
+        if (WlanQueryInterface(hClient, &pIfList->InterfaceInfo[i].InterfaceGuid,
+            wlan_intf_opcode_current_connection, NULL, &connectSize,
+            (PVOID*)&pConnectInfo, &opCode) != ERROR_SUCCESS) continue;
+
+        bool connected = pConnectInfo->isState == wlan_interface_state_connected;
+        if (connected) {
+            const DOT11_SSID& s = pConnectInfo->wlanAssociationAttributes.dot11Ssid;
+            ssid = string((char*)s.ucSSID, s.uSSIDLength);
+        }
+        WlanFreeMemory(pConnectInfo);
+        if (connected) break;
+    }
+
+    WlanFreeMemory(pIfList);
+    WlanCloseHandle(hClient, NULL);
+    return ssid;
+}
+
+// the Windows sections use iphlpapi directly
+static NetSnapshot probe_network() {
+    return NetSnapshot();
+}
+
+#else
+
+static unsigned long long probe_uptime_ms() {
+    // CLOCK_BOOTTIME keeps counting during suspend, like GetTickCount64
+    timespec ts{};
+    if (clock_gettime(CLOCK_BOOTTIME, &ts) != 0) return 0;
+    return static_cast<unsigned long long>(ts.tv_sec) * 1000ULL + static_cast<unsigned long long>(ts.tv_nsec / 1000000);
+}
+
+// the static half of the DRM card walk; driver "amdgpu 1.2.3" or just "i915"
+static vector<GpuAdapter> probe_gpu_adapters() {
+    vector<GpuAdapter> list;
+    for (const DrmGpu& gpu : drm_gpu_cards()) {
+        GpuAdapter a;
+        a.name = gpu.name;
+        a.vendorId = gpu.vendorId;
+        a.vramBytes = gpu.vramBytes;
+        a.driverVersion = gpu.driver.empty() ? "Unknown" : gpu.driver;
+        if (!gpu.driverVersion.empty()) a.driverVersion += " " + gpu.driverVersion;
+        list.push_back(a);
+    }
+    return list;
+}
+
+// nl80211 only knows an SSID for the interface that is actually associated
+static string probe_wifi_ssid() {
+    NetSnapshot net = FactStore::network();
+    const NetInterface* nic = net.active();
+    return (nic && nic->wireless) ? netlink_wifi_ssid(nic->index) : "";
+}
+
+static NetSnapshot probe_network() {
+    return netlink_snapshot();
+}
+#endif
+
+// GPU adapters only change with new hardware or a driver install, so the
+// list also survives across runs in the StaticCache (keyed by boot id).
+static vector<GpuAdapter> cached_gpu_adapters() {
+    vector<StaticCache::Record> records = StaticCache::instance().records("gpu.adapters", [] {
+        vector<StaticCache::Record> out;
+        for (const auto& a : probe_gpu_adapters()) {
+            out.push_back({ {"name", a.name}, {"vendor_id", to_string(a.vendorId)},
+                {"vram_bytes", to_string(a.vramBytes)}, {"driver_version", a.driverVersion} });
+        }
+        return out;
+        });
+
+    vector<GpuAdapter> list;
+    for (auto& r : records) {
+        GpuAdapter a;
+        a.name = r["name"];
+        a.vendorId = static_cast<unsigned>(strtoul(r["vendor_id"].c_str(), nullptr, 10));
+        a.vramBytes = strtoull(r["vram_bytes"].c_str(), nullptr, 10);
+        a.driverVersion = r["driver_version"];
+        list.push_back(a);
+    }
+    return list;
+}
+
+// -------------------- Shared facts --------------------
+unsigned long long FactStore::uptimeMs() {
+    return instance().get<unsigned long long>(FactId::UptimeMs, probe_uptime_ms);
+}
+
+vector<GpuAdapter> FactStore::gpuAdapters() {
+    return instance().get<vector<GpuAdapter>>(FactId::GpuAdapters, cached_gpu_adapters);
+}
+
+string FactStore::wifiSsid() {
+    return instance().get<string>(FactId::WifiSsid, probe_wifi_ssid);
+}
+
+NetSnapshot FactStore::network() {
+    return instance().get<NetSnapshot>(FactId::Network, probe_network);
+}
+
+const NetInterface* NetSnapshot::active() const {
+    for (const auto& nic : interfaces) {
+        if (activeIndex != 0 && nic.index == activeIndex) return &nic;
+    }
+    // no default route (offline, or only link-local): first usable interface
+    for (const auto& nic : interfaces) {
+        if (nic.loopback || nic.operState != "up") continue;
+        for (const auto& a : nic.addresses) {
+            if (a.family == AF_INET) return &nic;
+        }
+    }
+    return nullptr;
+}
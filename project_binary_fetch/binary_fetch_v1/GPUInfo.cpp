@@ -1,4 +1,8 @@
-﻿#include "include\GPUInfo.h"
+﻿#include "include/GPUInfo.h"
+#include "include/FactStore.h"
+
+// Windows only - the Linux implementation lives in GPUInfoLinux.cpp
+#ifdef _WIN32
 #include <windows.h> // Core Windows API (often sucks)
 #include <dxgi1_6.h> // DirectX Graphics Infrastructure (DXGI) for GPU enumeration
 #include <d3d12.h>  // Direct3D 12 (not directly used here, but often included with DXGI)
@@ -15,17 +19,6 @@
 
 using namespace std;
 
-// ----------------------------------------------------
-// Helper: convert wide string → UTF-8 string
-static string wstr_to_utf8(const wstring& w)
-{
-    if (w.empty()) return {};
-    int sz = WideCharToMultiByte(CP_UTF8, 0, w.c_str(), -1, nullptr, 0, nullptr, nullptr);
-    string r(sz - 1, 0);
-    WideCharToMultiByte(CP_UTF8, 0, w.c_str(), -1, &r[0], sz, nullptr, nullptr);
-    return r;
-}
-
 // ----------------------------------------------------
 // Helper: query WMI for GPU temperature (tries multiple methods)
 //
@@ -515,8 +508,9 @@ vector<gpu_data> GPUInfo::get_all_gpu_info()
 {
     vector<gpu_data> list;
 
-    IDXGIFactory6* factory = nullptr;
-    if (FAILED(CreateDXGIFactory1(IID_PPV_ARGS(&factory))))
+    // Adapter list is shared with DetailedGPUInfo / CompactGPU (one DXGI walk per run)
+    vector<GpuAdapter> adapters = FactStore::gpuAdapters();
+    if (adapters.empty())
         return list;
 
     // Init NVAPI once (for NVIDIA GPUs)
@@ -534,27 +528,16 @@ vector<gpu_data> GPUInfo::get_all_gpu_info()
         }
     }
 
-    IDXGIAdapter4* adapter = nullptr;
     UINT adapterIndex = 0;
 
-    // Enumerate all adapters
-    for (UINT i = 0;
-        factory->EnumAdapters1(i, (IDXGIAdapter1**)&adapter) != DXGI_ERROR_NOT_FOUND;
-        ++i)
+    for (const GpuAdapter& adapter : adapters)
     {
-        DXGI_ADAPTER_DESC3 desc{};
-        if (FAILED(adapter->GetDesc3(&desc)))
-        {
-            adapter->Release();
-            continue;
-        }
-
         gpu_data d;
 
         // Basic info
-        d.gpu_name = wstr_to_utf8(desc.Description);
+        d.gpu_name = adapter.name;
 
-        double memGB = static_cast<double>(desc.DedicatedVideoMemory) /
+        double memGB = static_cast<double>(adapter.vramBytes) /
             (1024.0 * 1024.0 * 1024.0);
         ostringstream memStream;
         memStream.precision(1);
@@ -562,24 +545,13 @@ vector<gpu_data> GPUInfo::get_all_gpu_info()
         d.gpu_memory = memStream.str() + " GB";
 
         // Driver version
-        LARGE_INTEGER driverVersion{};
-        if (SUCCEEDED(adapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &driverVersion)))
-        {
-            ostringstream oss;
-            oss << HIWORD(driverVersion.HighPart) << "."
-                << LOWORD(driverVersion.HighPart) << "."
-                << HIWORD(driverVersion.LowPart) << "."
-                << LOWORD(driverVersion.LowPart);
-            d.gpu_driver_version = oss.str();
-        }
-        else
-            d.gpu_driver_version = "Unknown";
+        d.gpu_driver_version = adapter.driverVersion;
 
         // Vendor
         d.gpu_vendor =
-            (desc.VendorId == 0x10DE) ? "NVIDIA" :
-            (desc.VendorId == 0x1002 || desc.VendorId == 0x1022) ? "AMD" :
-            (desc.VendorId == 0x8086) ? "Intel" : "Unknown";
+            (adapter.vendorId == 0x10DE) ? "NVIDIA" :
+            (adapter.vendorId == 0x1002 || adapter.vendorId == 0x1022) ? "AMD" :
+            (adapter.vendorId == 0x8086) ? "Intel" : "Unknown";
 
         // Defaults
         d.gpu_usage = -1.0f;
@@ -588,7 +560,7 @@ vector<gpu_data> GPUInfo::get_all_gpu_info()
         d.gpu_frequency = -1.0f;
 
         // NVIDIA fast path
-        if (is_nvidia_gpu(desc.VendorId) && nvapiInitialized && adapterIndex < nvapiGpuCount)
+        if (is_nvidia_gpu(adapter.vendorId) && nvapiInitialized && adapterIndex < nvapiGpuCount)
         {
             NvPhysicalGpuHandle handle = nvapiHandles[adapterIndex];
             d.gpu_temperature = get_nvapi_temperature(handle);
@@ -606,16 +578,14 @@ vector<gpu_data> GPUInfo::get_all_gpu_info()
             d.gpu_core_count = get_gpu_core_count();
 
         list.push_back(d);
-        adapter->Release();
 
-        if (is_nvidia_gpu(desc.VendorId))
+        if (is_nvidia_gpu(adapter.vendorId))
             adapterIndex++;
     }
 
     if (nvapiInitialized)
         NvAPI_Unload();
 
-    factory->Release();
     return list;
 }
 
@@ -675,8 +645,7 @@ Windows uses UTF-16.
 Humans use UTF-8.
 JSON hates broken text.
 
-So:
-wstr_to_utf8()
+So the shared adapter list (FactStore::gpuAdapters())
 - Converts GPU names properly
 - Prevents cursed terminal output
 - Saves your sanity
@@ -773,7 +742,7 @@ Yes, that’s dumb.
 MAIN PIPELINE (THE ACTUAL WORK)
 --------------------------------------------------------------------------------
 For every detected GPU:
-1️⃣ Enumerate via DXGI
+1️⃣ Enumerate via DXGI (once per run, shared through FactStore)
 2️⃣ Read static info
 3️⃣ Try NVAPI (if NVIDIA)
 4️⃣ Fallback to WMI
@@ -810,3 +779,5 @@ So we adapted.
 End of story. 
 ================================================================================
 */
+
+#endif // _WIN32
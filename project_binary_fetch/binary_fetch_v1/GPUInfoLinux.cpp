@@ -0,0 +1,82 @@
+/*
+================================================================================
+ GPUInfoLinux.cpp — GPUInfo for Linux
+================================================================================
+
+No DXGI, no NVAPI, no WMI. Every GPU the kernel drives shows up as
+/sys/class/drm/card<N>, and its device/ directory already has everything
+gpu_data wants. drm_gpu_cards() (LinuxDrm.cpp) walks each card once:
+
+    vendor / device    device/uevent PCI_ID      (+ PCI_SLOT_NAME, DRIVER)
+    name               device/product_name, else the pci.ids database
+    VRAM               device/mem_info_vram_total           (amdgpu only)
+    usage              device/gpu_busy_percent               (amdgpu only)
+    temperature        device/hwmon/hwmonN/temp1_input
+    clock              device/pp_dpm_sclk '*' level, else hwmon freq1_input
+
+Whatever a driver doesn't publish keeps the same "unknown" value the Windows
+path falls back to: usage 0, temperature -1, frequency -1, cores 0.
+i915 / nouveau have no busy or VRAM files; the proprietary NVIDIA driver keeps
+its numbers behind NVML, so those cards report name + driver only.
+================================================================================
+*/
+#include "include/GPUInfo.h"
+
+#ifndef _WIN32
+#include "include/LinuxDrm.h"
+
+#include <sstream>
+#include <iomanip>
+using namespace std;
+
+static string vendor_name(unsigned vendorId) {
+    return (vendorId == 0x10DE) ? "NVIDIA" :
+        (vendorId == 0x1002 || vendorId == 0x1022) ? "AMD" :
+        (vendorId == 0x8086) ? "Intel" : "Unknown";
+}
+
+// -------------------- GPUInfo --------------------
+
+float GPUInfo::get_gpu_usage() {
+    vector<DrmGpu> gpus = drm_gpu_cards();
+    return (!gpus.empty() && gpus[0].busyPercent >= 0) ? static_cast<float>(gpus[0].busyPercent) : 0.0f;
+}
+
+float GPUInfo::get_gpu_temperature() {
+    vector<DrmGpu> gpus = drm_gpu_cards();
+    return gpus.empty() ? -1.0f : gpus[0].temperatureC;
+}
+
+// sysfs has no shader count for any driver
+int GPUInfo::get_gpu_core_count() {
+    return 0;
+}
+
+vector<gpu_data> GPUInfo::get_all_gpu_info() {
+    vector<gpu_data> list;
+
+    // one walk for every card; the per-field getters above are for single values
+    for (const DrmGpu& gpu : drm_gpu_cards()) {
+        gpu_data d;
+        d.gpu_name = gpu.name;
+
+        double memGB = static_cast<double>(gpu.vramBytes) / (1024.0 * 1024.0 * 1024.0);
+        ostringstream memStream;
+        memStream << fixed << setprecision(1) << memGB;
+        d.gpu_memory = memStream.str() + " GB";
+
+        d.gpu_driver_version = gpu.driver.empty() ? "Unknown" : gpu.driver;
+        if (!gpu.driverVersion.empty()) d.gpu_driver_version += " " + gpu.driverVersion;
+
+        d.gpu_vendor = vendor_name(gpu.vendorId);
+        d.gpu_usage = gpu.busyPercent >= 0 ? static_cast<float>(gpu.busyPercent) : 0.0f;
+        d.gpu_temperature = gpu.temperatureC;
+        d.gpu_core_count = 0;
+        d.gpu_frequency = gpu.clockMHz;
+
+        list.push_back(d);
+    }
+    return list;
+}
+
+#endif
@@ -0,0 +1,164 @@
+#include "include/LineTemplate.h"
+#include <cstdio>
+
+using namespace std;
+
+// -------------------- Compile --------------------
+
+// "a", "a|b" (either on), "a&b" (both on)
+static bool flag_expression(const ConfigIndex& cfg, ConfigKey section, const string& expr) {
+    bool any = expr.find('|') != string::npos;
+    char separator = any ? '|' : '&';
+    size_t start = 0;
+    while (true) {
+        size_t end = expr.find(separator, start);
+        string name = expr.substr(start, end == string::npos ? string::npos : end - start);
+        bool on = cfg.flag({ section, name });
+        if (any && on) return true;
+        if (!any && !on) return false;
+        if (end == string::npos) return !any;
+        start = end + 1;
+    }
+}
+
+bool LineTemplate::compile(const string& source, const ConfigIndex& cfg, ConfigKey section,
+    initializer_list<const char*> fields) {
+    text.clear();
+    ops.clear();
+    fieldNames.assign(fields.begin(), fields.end());
+    used.assign(fieldNames.size(), false);
+    message.clear();
+
+    vector<bool> shown;            // one per open {if}
+    bool visible = true;
+    auto literal = [&](const char* s, size_t n) {
+        if (!visible || n == 0) return;
+        // neighbouring literals (text, colors) become one span
+        if (!ops.empty() && ops.back().field < 0) {
+            ops.back().size += n;
+        }
+        else {
+            ops.push_back({ -1, -1, text.size(), n });
+        }
+        text.append(s, n);
+    };
+    auto fail = [&](const string& what) {
+        message = what;
+        text.clear();
+        ops.clear();
+        return false;
+    };
+
+    size_t i = 0;
+    while (i < source.size()) {
+        char c = source[i];
+        if ((c == '{' || c == '}') && i + 1 < source.size() && source[i + 1] == c) {
+            literal(&source[i], 1);
+            i += 2;
+            continue;
+        }
+        if (c == '}') return fail("unmatched '}' at " + to_string(i));
+        if (c != '{') {
+            size_t next = source.find_first_of("{}", i);
+            if (next == string::npos) next = source.size();
+            literal(&source[i], next - i);
+            i = next;
+            continue;
+        }
+
+        size_t close = source.find('}', i + 1);
+        if (close == string::npos) return fail("unterminated '{' at " + to_string(i));
+        string tag = source.substr(i + 1, close - i - 1);
+        i = close + 1;
+
+        size_t colon = tag.find(':');
+        string name = tag.substr(0, colon);
+        string arg = colon == string::npos ? string() : tag.substr(colon + 1);
+
+        if (name == "color" && colon != string::npos) {
+            // same lookup order as getColor(): colors block, section, then the palette
+            const string& ansi = cfg.has({ section, "colors", arg })
+                ? cfg.color({ section, "colors", arg }, "white")
+                : cfg.color({ section, arg }, arg);
+            literal(ansi.data(), ansi.size());
+        }
+        else if (tag == "reset") {
+            const string& ansi = cfg.color("reset");
+            literal(ansi.data(), ansi.size());
+        }
+        else if (name == "if" && colon != string::npos) {
+            shown.push_back(visible);
+            visible = visible && flag_expression(cfg, section, arg);
+        }
+        else if (tag == "end") {
+            if (shown.empty()) return fail("{end} without {if}");
+            visible = shown.back();
+            shown.pop_back();
+        }
+        else {
+            int field = -1;
+            for (size_t f = 0; f < fieldNames.size(); ++f) {
+                if (fieldNames[f] == name) { field = static_cast<int>(f); break; }
+            }
+            if (field < 0) return fail("unknown field {" + name + "}");
+
+            int precision = -1;
+            if (colon != string::npos) {
+                // ".Nf" only
+                if (arg.size() < 3 || arg[0] != '.' || arg.back() != 'f' || arg.size() > 4) return fail("bad format {" + tag + "}");
+                precision = 0;
+                for (size_t k = 1; k + 1 < arg.size(); ++k) {
+                    if (arg[k] < '0' || arg[k] > '9') return fail("bad format {" + tag + "}");
+                    precision = precision * 10 + (arg[k] - '0');
+                }
+            }
+            if (visible) {
+                ops.push_back({ field, precision, 0, 0 });
+                used[field] = true;
+            }
+        }
+    }
+    if (!shown.empty()) return fail("{if} without {end}");
+    return true;
+}
+
+bool LineTemplate::uses(const char* field) const {
+    for (size_t f = 0; f < fieldNames.size(); ++f) {
+        if (fieldNames[f] == field) return used[f];
+    }
+    return false;
+}
+
+// -------------------- Render --------------------
+
+void LineTemplate::render(initializer_list<TemplateValue> values, string& out) const {
+    out.clear();
+    const TemplateValue* value = values.begin();
+    char number[64];
+
+    for (const Op& op : ops) {
+        if (op.field < 0) {
+            out.append(text, op.offset, op.size);
+            continue;
+        }
+        if (static_cast<size_t>(op.field) >= values.size()) continue;
+
+        const TemplateValue& v = value[op.field];
+        int n = 0;
+        if (v.kind == TemplateValue::Kind::Text) {
+            out.append(v.text, v.size);
+        }
+        else if (op.precision >= 0) {
+            double real = v.kind == TemplateValue::Kind::Real ? v.real : static_cast<double>(v.integer);
+            n = snprintf(number, sizeof(number), "%.*f", op.precision, real);
+        }
+        else if (v.kind == TemplateValue::Kind::Integer) {
+            n = snprintf(number, sizeof(number), "%lld", v.integer);
+        }
+        else {
+            // what "cout << double" prints
+            n = snprintf(number, sizeof(number), "%g", v.real);
+        }
+        if (n > 0) out.append(number, static_cast<size_t>(n) < sizeof(number) ? n : sizeof(number) - 1);
+    }
+}
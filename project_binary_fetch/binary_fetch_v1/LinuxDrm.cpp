@@ -0,0 +1,201 @@
+#include "include/LinuxDrm.h"
+
+#ifndef _WIN32
+#include "include/LinuxSysfs.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <cstdlib>
+#include <dirent.h>
+#include <unistd.h>
+using namespace std;
+
+// "card0-HDMI-A-1" -> card0 / HDMI-A-1 ("card0" alone is the GPU itself)
+static bool split_connector(const char* entry, string& card, string& connector) {
+    if (strncmp(entry, "card", 4) != 0) return false;
+    const char* dash = strchr(entry, '-');
+    if (!dash || !dash[1]) return false;
+    card.assign(entry, static_cast<size_t>(dash - entry));
+    connector = dash + 1;
+    return true;
+}
+
+vector<DrmOutput> drm_connected_outputs(const string& root) {
+    vector<DrmOutput> outputs;
+    DIR* dir = opendir(root.c_str());
+    if (!dir) return outputs;
+
+    vector<string> entries;
+    while (dirent* e = readdir(dir)) entries.push_back(e->d_name);
+    closedir(dir);
+    sort(entries.begin(), entries.end());
+
+    char status[32];
+    for (const auto& name : entries) {
+        DrmOutput out;
+        if (!split_connector(name.c_str(), out.card, out.connector)) continue;
+
+        string base = root + "/" + name;
+        if (sysfs_read((base + "/status").c_str(), status, sizeof(status)) <= 0) continue;
+        if (strcmp(status, "connected") != 0) continue;
+
+        istringstream modes(sysfs_read_all((base + "/modes").c_str()));
+        string mode;
+        while (getline(modes, mode)) {
+            int w = 0, h = 0;
+            if (sscanf(mode.c_str(), "%dx%d", &w, &h) == 2 && w > 0 && h > 0) out.modes.push_back({ w, h });
+        }
+
+        string edid = sysfs_read_all((base + "/edid").c_str());
+        out.edid.assign(edid.begin(), edid.end());
+
+        outputs.push_back(out);
+    }
+    return outputs;
+}
+
+int drm_edid_refresh_rate(const unsigned char* edid, size_t size) {
+    if (!edid || size < 72) return 0;
+
+    // first detailed timing descriptor, bytes 54-71
+    const unsigned char* d = edid + 54;
+    unsigned long pixelClock = (d[0] | (d[1] << 8)) * 10000UL;    // 10 kHz units
+    unsigned hTotal = (d[2] | ((d[4] & 0xF0) << 4)) + (d[3] | ((d[4] & 0x0F) << 8));
+    unsigned vTotal = (d[5] | ((d[7] & 0xF0) << 4)) + (d[6] | ((d[7] & 0x0F) << 8));
+    if (pixelClock == 0 || hTotal == 0 || vTotal == 0) return 0;
+
+    return static_cast<int>((pixelClock + (hTotal * vTotal) / 2) / (hTotal * vTotal));
+}
+
+// -------------------- GPUs --------------------
+
+// "card0" yes, "card0-DP-1" / "renderD128" / "version" no
+static bool is_card(const char* entry) {
+    if (strncmp(entry, "card", 4) != 0 || !entry[4]) return false;
+    for (const char* p = entry + 4; *p; ++p) {
+        if (*p < '0' || *p > '9') return false;
+    }
+    return true;
+}
+
+// KEY=value lines of a uevent file
+static void parse_uevent(const string& text, DrmGpu& gpu) {
+    istringstream lines(text);
+    string line;
+    while (getline(lines, line)) {
+        if (line.compare(0, 7, "DRIVER=") == 0) gpu.driver = line.substr(7);
+        else if (line.compare(0, 14, "PCI_SLOT_NAME=") == 0) gpu.pciSlot = line.substr(14);
+        else if (line.compare(0, 7, "PCI_ID=") == 0) sscanf(line.c_str() + 7, "%x:%x", &gpu.vendorId, &gpu.deviceId);
+    }
+}
+
+// temp1_input (millidegrees) and freq1_input (Hz) of the first hwmon that has them
+static void read_hwmon(const string& device, DrmGpu& gpu) {
+    string base = device + "/hwmon";
+    DIR* dir = opendir(base.c_str());
+    if (!dir) return;
+
+    while (dirent* e = readdir(dir)) {
+        if (strncmp(e->d_name, "hwmon", 5) != 0) continue;
+        string hwmon = base + "/" + e->d_name;
+        long long temp = sysfs_read_long((hwmon + "/temp1_input").c_str(), -1);
+        long long freq = sysfs_read_long((hwmon + "/freq1_input").c_str(), -1);
+        if (temp >= 0 && gpu.temperatureC < 0) gpu.temperatureC = temp / 1000.0f;
+        if (freq > 0 && gpu.clockMHz < 0) gpu.clockMHz = freq / 1000000.0f;
+    }
+    closedir(dir);
+}
+
+float drm_dpm_current_mhz(const string& table) {
+    istringstream lines(table);
+    string line;
+    while (getline(lines, line)) {
+        if (line.find('*') == string::npos) continue;
+        size_t colon = line.find(':');
+        float mhz = 0;
+        if (colon != string::npos && sscanf(line.c_str() + colon + 1, "%f", &mhz) == 1 && mhz > 0) return mhz;
+    }
+    return -1.0f;
+}
+
+vector<DrmGpu> drm_gpu_cards(const string& root, const string& module_root) {
+    vector<DrmGpu> gpus;
+    DIR* dir = opendir(root.c_str());
+    if (!dir) return gpus;
+
+    vector<string> cards;
+    while (dirent* e = readdir(dir)) {
+        if (is_card(e->d_name)) cards.push_back(e->d_name);
+    }
+    closedir(dir);
+    sort(cards.begin(), cards.end(), [](const string& a, const string& b) {
+        return atoi(a.c_str() + 4) < atoi(b.c_str() + 4);
+        });
+
+    for (const auto& card : cards) {
+        DrmGpu gpu;
+        gpu.card = card;
+        string device = root + "/" + card + "/device";
+
+        // simpledrm / efifb and other non-PCI framebuffers are not GPUs
+        parse_uevent(sysfs_read_all((device + "/uevent").c_str()), gpu);
+        if (gpu.vendorId == 0 || gpu.pciSlot.empty()) continue;
+
+        if (!gpu.driver.empty())
+            gpu.driverVersion = sysfs_read_string((module_root + "/" + gpu.driver + "/version").c_str());
+
+        gpu.name = sysfs_read_string((device + "/product_name").c_str());
+        if (gpu.name.empty()) gpu.name = drm_pci_device_name(gpu.vendorId, gpu.deviceId);
+        if (gpu.name.empty()) {
+            char ids[32];
+            snprintf(ids, sizeof(ids), "GPU [%04x:%04x]", gpu.vendorId, gpu.deviceId);
+            gpu.name = ids;
+        }
+
+        long long vram = sysfs_read_long((device + "/mem_info_vram_total").c_str(), 0);
+
+        if (vram > 0) gpu.vramBytes = static_cast<unsigned long long>(vram);
+        gpu.busyPercent = static_cast<int>(sysfs_read_long((device + "/gpu_busy_percent").c_str(), -1));
+
+        read_hwmon(device, gpu);
+        float sclk = drm_dpm_current_mhz(sysfs_read_all((device + "/pp_dpm_sclk").c_str()));
+        if (sclk > 0) gpu.clockMHz = sclk;   // the DPM level beats the averaged hwmon reading
+
+        gpus.push_back(gpu);
+    }
+    return gpus;
+}
+
+string drm_pci_device_name(unsigned vendorId, unsigned deviceId, const char* ids_path) {
+    static const char* const paths[] = { "/usr/share/hwdata/pci.ids", "/usr/share/misc/pci.ids", "/usr/share/pci.ids" };
+    FILE* f = nullptr;
+    if (ids_path) f = fopen(ids_path, "r");
+    for (size_t i = 0; !ids_path && !f && i < sizeof(paths) / sizeof(paths[0]); ++i) f = fopen(paths[i], "r");
+    if (!f) return "";
+
+    // "1002  Advanced Micro Devices..." then "\t73bf  Navi 21 [...]" below it
+    char line[512];
+    bool inVendor = false;
+    string name;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        unsigned id = 0;
+        if (line[0] != '\t') {
+            if (inVendor) break;                      // next vendor: device not listed
+            inVendor = sscanf(line, "%4x", &id) == 1 && id == vendorId;
+        }
+        else if (inVendor && line[1] != '\t' && sscanf(line + 1, "%4x", &id) == 1 && id == deviceId) {
+            name = line + 1 + 4;
+            break;
+        }
+    }
+    fclose(f);
+
+    size_t first = name.find_first_not_of(" \t");
+    size_t last = name.find_last_not_of(" \t\r\n");
+    return first == string::npos ? "" : name.substr(first, last - first + 1);
+}
+
+#endif
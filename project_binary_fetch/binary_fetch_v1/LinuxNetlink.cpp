@@ -0,0 +1,285 @@
+#include "include/LinuxNetlink.h"
+
+#ifndef _WIN32
+#include "include/LinuxSysfs.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <functional>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <net/if_arp.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/genetlink.h>
+using namespace std;
+
+// nl80211 ids (linux/nl80211.h isn't installed everywhere)
+static const uint8_t NL80211_CMD_GET_INTERFACE_ID = 5;
+static const uint16_t NL80211_ATTR_IFINDEX_ID = 3;
+static const uint16_t NL80211_ATTR_SSID_ID = 52;
+
+// -------------------- Socket helpers --------------------
+
+// request under construction: nlmsghdr + fixed header + attributes
+class NetlinkRequest {
+public:
+    NetlinkRequest(uint16_t type, uint16_t flags, const void* header, size_t size) : buf(NLMSG_HDRLEN, '\0') {
+        append(header, size);
+        nlmsghdr* h = hdr();
+        h->nlmsg_type = type;
+        h->nlmsg_flags = flags;
+    }
+
+    void attr(uint16_t type, const void* data, size_t size) {
+        nlattr a;
+        a.nla_len = static_cast<uint16_t>(NLA_HDRLEN + size);
+        a.nla_type = type;
+        append(&a, sizeof(a));
+        append(data, size);
+    }
+
+    nlmsghdr* finish(uint32_t seq) {
+        nlmsghdr* h = hdr();
+        h->nlmsg_len = static_cast<uint32_t>(buf.size());
+        h->nlmsg_seq = seq;
+        return h;
+    }
+
+private:
+    string buf;
+    nlmsghdr* hdr() { return reinterpret_cast<nlmsghdr*>(&buf[0]); }
+    void append(const void* data, size_t size) {
+        buf.append(static_cast<const char*>(data), size);
+        buf.resize(NLMSG_ALIGN(buf.size()), '\0');
+    }
+};
+
+static int netlink_open(int protocol) {
+    int fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, protocol);
+    if (fd < 0) return -1;
+
+    // a dead kernel reply must not hang the fetch
+    timeval tv{ 1, 0 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    return fd;
+}
+
+// send one request, hand every reply message to onMessage.
+// Dumps end with NLMSG_DONE, plain requests after their first answer.
+static bool netlink_exchange(int fd, NetlinkRequest& req, uint32_t seq, const function<void(const nlmsghdr*)>& onMessage) {
+    nlmsghdr* h = req.finish(seq);
+    bool dump = (h->nlmsg_flags & NLM_F_DUMP) == NLM_F_DUMP;
+
+    sockaddr_nl kernel{};
+    kernel.nl_family = AF_NETLINK;
+    if (sendto(fd, h, h->nlmsg_len, 0, reinterpret_cast<sockaddr*>(&kernel), sizeof(kernel)) < 0) return false;
+
+    alignas(nlmsghdr) char buf[65536];
+    for (;;) {
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) return false;
+
+        int len = static_cast<int>(n);
+        for (const nlmsghdr* m = reinterpret_cast<const nlmsghdr*>(buf); NLMSG_OK(m, len); m = NLMSG_NEXT(m, len)) {
+            if (m->nlmsg_seq != seq) continue;
+            if (m->nlmsg_type == NLMSG_DONE) return true;
+            if (m->nlmsg_type == NLMSG_ERROR) return false;
+            onMessage(m);
+            if (!dump) return true;
+        }
+    }
+}
+
+// -------------------- RTM_GETLINK / GETADDR / GETROUTE --------------------
+
+static string format_mac(const unsigned char* p, size_t len) {
+    string mac;
+    char part[4];
+    for (size_t i = 0; i < len; ++i) {
+        snprintf(part, sizeof(part), i ? ":%02X" : "%02X", p[i]);
+        mac += part;
+    }
+    return mac;
+}
+
+static const char* oper_state_name(unsigned state) {
+    static const char* names[] = { "unknown", "notpresent", "down", "lowerlayerdown", "testing", "dormant", "up" };
+    return state < sizeof(names) / sizeof(names[0]) ? names[state] : "unknown";
+}
+
+static void parse_link(const nlmsghdr* m, NetSnapshot& net) {
+    const ifinfomsg* ifi = static_cast<const ifinfomsg*>(NLMSG_DATA(m));
+    NetInterface nic;
+    nic.index = ifi->ifi_index;
+    nic.loopback = (ifi->ifi_flags & IFF_LOOPBACK) != 0;
+    nic.operState = (ifi->ifi_flags & IFF_UP) ? "unknown" : "down";
+
+    int len = static_cast<int>(IFLA_PAYLOAD(m));
+    for (const rtattr* a = IFLA_RTA(ifi); RTA_OK(a, len); a = RTA_NEXT(a, len)) {
+        const unsigned char* data = static_cast<const unsigned char*>(RTA_DATA(a));
+        switch (a->rta_type) {
+        case IFLA_IFNAME:    nic.name = reinterpret_cast<const char*>(data); break;
+        case IFLA_ADDRESS:   if (ifi->ifi_type != ARPHRD_LOOPBACK) nic.mac = format_mac(data, RTA_PAYLOAD(a)); break;
+        case IFLA_OPERSTATE: nic.operState = oper_state_name(*data); break;
+        }
+    }
+    net.interfaces.push_back(nic);
+}
+
+static void parse_addr(const nlmsghdr* m, NetSnapshot& net) {
+    const ifaddrmsg* ifa = static_cast<const ifaddrmsg*>(NLMSG_DATA(m));
+    if (ifa->ifa_family != AF_INET && ifa->ifa_family != AF_INET6) return;
+
+    // IPv4: IFA_LOCAL is our address (IFA_ADDRESS is the peer on p2p links)
+    const void* local = nullptr;
+    const void* address = nullptr;
+    int len = static_cast<int>(IFA_PAYLOAD(m));
+    for (const rtattr* a = IFA_RTA(ifa); RTA_OK(a, len); a = RTA_NEXT(a, len)) {
+        if (a->rta_type == IFA_LOCAL) local = RTA_DATA(a);
+        else if (a->rta_type == IFA_ADDRESS) address = RTA_DATA(a);
+    }
+    const void* bytes = (ifa->ifa_family == AF_INET && local) ? local : address;
+    if (!bytes) return;
+
+    char text[INET6_ADDRSTRLEN];
+    if (!inet_ntop(ifa->ifa_family, bytes, text, sizeof(text))) return;
+
+    for (auto& nic : net.interfaces) {
+        if (nic.index != static_cast<int>(ifa->ifa_index)) continue;
+        NetAddress addr;
+        addr.family = ifa->ifa_family;
+        addr.address = text;
+        addr.prefix = ifa->ifa_prefixlen;
+        nic.addresses.push_back(addr);
+        break;
+    }
+}
+
+struct DefaultRoute {
+    int family = 0;
+    int ifindex = 0;
+    uint32_t metric = 0;
+};
+
+// default route of the main table with the best (family, metric)
+static void parse_route(const nlmsghdr* m, DefaultRoute& best) {
+    const rtmsg* rt = static_cast<const rtmsg*>(NLMSG_DATA(m));
+    if (rt->rtm_dst_len != 0 || rt->rtm_type != RTN_UNICAST) return;
+
+    uint32_t table = rt->rtm_table;
+    uint32_t metric = 0;
+    int ifindex = 0;
+    int len = static_cast<int>(RTM_PAYLOAD(m));
+    for (const rtattr* a = RTM_RTA(rt); RTA_OK(a, len); a = RTA_NEXT(a, len)) {
+        if (a->rta_type == RTA_TABLE) table = *static_cast<const uint32_t*>(RTA_DATA(a));
+        else if (a->rta_type == RTA_PRIORITY) metric = *static_cast<const uint32_t*>(RTA_DATA(a));
+        else if (a->rta_type == RTA_OIF) ifindex = *static_cast<const int*>(RTA_DATA(a));
+        else if (a->rta_type == RTA_MULTIPATH && !ifindex && RTA_PAYLOAD(a) >= sizeof(rtnexthop))
+            ifindex = static_cast<const rtnexthop*>(RTA_DATA(a))->rtnh_ifindex; // first hop
+    }
+    if (table != RT_TABLE_MAIN || ifindex == 0) return;
+
+    // IPv4 first, then lowest metric
+    bool better = best.ifindex == 0
+        || (rt->rtm_family == AF_INET && best.family != AF_INET)
+        || (rt->rtm_family == best.family && metric < best.metric);
+    if (better) {
+        best.family = rt->rtm_family;
+        best.ifindex = ifindex;
+        best.metric = metric;
+    }
+}
+
+NetSnapshot netlink_snapshot() {
+    NetSnapshot net;
+    int fd = netlink_open(NETLINK_ROUTE);
+    if (fd < 0) return net;
+
+    ifinfomsg link{};
+    link.ifi_family = AF_UNSPEC;
+    NetlinkRequest links(RTM_GETLINK, NLM_F_REQUEST | NLM_F_DUMP, &link, sizeof(link));
+    netlink_exchange(fd, links, 1, [&](const nlmsghdr* m) { if (m->nlmsg_type == RTM_NEWLINK) parse_link(m, net); });
+
+    ifaddrmsg addr{};
+    addr.ifa_family = AF_UNSPEC;
+    NetlinkRequest addrs(RTM_GETADDR, NLM_F_REQUEST | NLM_F_DUMP, &addr, sizeof(addr));
+    netlink_exchange(fd, addrs, 2, [&](const nlmsghdr* m) { if (m->nlmsg_type == RTM_NEWADDR) parse_addr(m, net); });
+
+    DefaultRoute best;
+    rtmsg route{};
+    route.rtm_family = AF_UNSPEC;
+    NetlinkRequest routes(RTM_GETROUTE, NLM_F_REQUEST | NLM_F_DUMP, &route, sizeof(route));
+    netlink_exchange(fd, routes, 3, [&](const nlmsghdr* m) { if (m->nlmsg_type == RTM_NEWROUTE) parse_route(m, best); });
+    net.activeIndex = best.ifindex;
+
+    close(fd);
+
+    // not in netlink: link speed (ethtool) and whether it's a WiFi device
+    char path[IFNAMSIZ + 40];
+    for (auto& nic : net.interfaces) {
+        if (nic.loopback) continue;
+        snprintf(path, sizeof(path), "/sys/class/net/%s/wireless", nic.name.c_str());
+        nic.wireless = access(path, F_OK) == 0;
+        if (nic.operState != "up") continue;
+        snprintf(path, sizeof(path), "/sys/class/net/%s/speed", nic.name.c_str());
+        nic.speedMbps = sysfs_read_long(path, -1);
+    }
+    return net;
+}
+
+// -------------------- nl80211 --------------------
+
+// walks the nlattr list following the generic netlink header
+static void for_each_genl_attr(const nlmsghdr* m, const function<void(const nlattr*)>& onAttr) {
+    const char* p = static_cast<const char*>(NLMSG_DATA(m)) + GENL_HDRLEN;
+    const char* end = reinterpret_cast<const char*>(m) + m->nlmsg_len;
+    while (p + NLA_HDRLEN <= end) {
+        const nlattr* a = reinterpret_cast<const nlattr*>(p);
+        if (a->nla_len < NLA_HDRLEN || p + a->nla_len > end) break;
+        onAttr(a);
+        p += NLA_ALIGN(a->nla_len);
+    }
+}
+
+string netlink_wifi_ssid(int ifindex) {
+    int fd = netlink_open(NETLINK_GENERIC);
+    if (fd < 0) return "";
+
+    // nl80211 has a dynamic family id, ask the controller for it
+    uint16_t family = 0;
+    genlmsghdr ctrl{};
+    ctrl.cmd = CTRL_CMD_GETFAMILY;
+    ctrl.version = 1;
+    NetlinkRequest resolve(GENL_ID_CTRL, NLM_F_REQUEST, &ctrl, sizeof(ctrl));
+    resolve.attr(CTRL_ATTR_FAMILY_NAME, "nl80211", sizeof("nl80211"));
+    netlink_exchange(fd, resolve, 1, [&](const nlmsghdr* m) {
+        for_each_genl_attr(m, [&](const nlattr* a) {
+            if ((a->nla_type & NLA_TYPE_MASK) == CTRL_ATTR_FAMILY_ID)
+                memcpy(&family, reinterpret_cast<const char*>(a) + NLA_HDRLEN, sizeof(family));
+            });
+        });
+
+    string ssid;
+    if (family != 0) {
+        genlmsghdr get{};
+        get.cmd = NL80211_CMD_GET_INTERFACE_ID;
+        NetlinkRequest query(family, NLM_F_REQUEST, &get, sizeof(get));
+        uint32_t index = static_cast<uint32_t>(ifindex);
+        query.attr(NL80211_ATTR_IFINDEX_ID, &index, sizeof(index));
+        netlink_exchange(fd, query, 2, [&](const nlmsghdr* m) {
+            for_each_genl_attr(m, [&](const nlattr* a) {
+                if ((a->nla_type & NLA_TYPE_MASK) == NL80211_ATTR_SSID_ID)
+                    ssid.assign(reinterpret_cast<const char*>(a) + NLA_HDRLEN, a->nla_len - NLA_HDRLEN);
+                });
+            });
+    }
+
+    close(fd);
+    return ssid;
+}
+
+#endif
@@ -0,0 +1,74 @@
+#include "include/LinuxSysfs.h"
+
+#ifndef _WIN32
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
+long sysfs_read(const char* path, char* buf, size_t size) {
+    if (size == 0) return -1;
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return -1;
+    ssize_t n = read(fd, buf, size - 1);
+    close(fd);
+    if (n < 0) return -1;
+
+    while (n > 0 && (buf[n - 1] == '\n' || buf[n - 1] == ' ')) --n;
+    buf[n] = '\0';
+    return static_cast<long>(n);
+}
+
+long long sysfs_read_long(const char* path, long long fallback) {
+    char buf[64];
+    if (sysfs_read(path, buf, sizeof(buf)) <= 0) return fallback;
+    char* end = nullptr;
+    long long v = strtoll(buf, &end, 10);
+    return end == buf ? fallback : v;
+}
+
+string sysfs_read_string(const char* path) {
+    char buf[256];
+    long n = sysfs_read(path, buf, sizeof(buf));
+    return n > 0 ? string(buf, static_cast<size_t>(n)) : string();
+}
+
+string sysfs_read_all(const char* path) {
+    string data;
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return data;
+
+    char buf[16384];
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0) data.append(buf, static_cast<size_t>(n));
+    close(fd);
+    return data;
+}
+
+int sysfs_count_cpu_list(const char* list) {
+    int count = 0;
+    const char* p = list;
+    while (*p) {
+        char* end = nullptr;
+        long first = strtol(p, &end, 10);
+        if (end == p) break;
+        long last = first;
+        p = end;
+        if (*p == '-') {
+            last = strtol(p + 1, &end, 10);
+            if (end == p + 1) break;
+            p = end;
+        }
+        if (last >= first) count += static_cast<int>(last - first + 1);
+        if (*p != ',') break;
+        ++p;
+    }
+    return count;
+}
+
+int sysfs_first_cpu(const char* list) {
+    char* end = nullptr;
+    long first = strtol(list, &end, 10);
+    return end == list ? -1 : static_cast<int>(first);
+}
+
+#endif
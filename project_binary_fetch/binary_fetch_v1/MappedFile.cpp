@@ -0,0 +1,97 @@
+#include "include/MappedFile.h"
+#include <fstream>
+#include <cstdio>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+bool MappedFile::open(const string& path) {
+    close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+        NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping) {
+            view = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            if (view) length = static_cast<size_t>(fileSize.QuadPart);
+            CloseHandle(mapping);      // the view keeps the mapping alive
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            view = static_cast<const char*>(mapped);
+            length = static_cast<size_t>(st.st_size);
+        }
+    }
+    ::close(fd);
+#endif
+    return view != nullptr;
+}
+
+void MappedFile::close() {
+    if (!view) return;
+#ifdef _WIN32
+    UnmapViewOfFile(view);
+#else
+    munmap(const_cast<char*>(view), length);
+#endif
+    view = nullptr;
+    length = 0;
+}
+
+bool MappedFile::stamp(const string& path, unsigned long long& time, unsigned long long& size) {
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA attr;
+    if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attr)) return false;
+    time = (static_cast<unsigned long long>(attr.ftLastWriteTime.dwHighDateTime) << 32) | attr.ftLastWriteTime.dwLowDateTime;
+    size = (static_cast<unsigned long long>(attr.nFileSizeHigh) << 32) | attr.nFileSizeLow;
+#else
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) return false;
+    time = static_cast<unsigned long long>(st.st_mtim.tv_sec) * 1000000000ULL + st.st_mtim.tv_nsec;
+    size = static_cast<unsigned long long>(st.st_size);
+#endif
+    return true;
+}
+
+bool MappedFile::replace(const string& path, const char* data, size_t size) {
+    // write aside and swap in, so a concurrent run never maps half a file
+    string temp = path + ".tmp";
+    {
+        ofstream out(temp, ios::binary | ios::trunc);
+        if (!out.is_open()) return false;
+        out.write(data, static_cast<streamsize>(size));
+        if (!out.good()) return false;
+    }
+#ifdef _WIN32
+    // fails while another run still has the old file mapped; it is
+    // simply rebuilt again next time
+    if (!MoveFileExA(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+        DeleteFileA(temp.c_str());
+        return false;
+    }
+#else
+    if (rename(temp.c_str(), path.c_str()) != 0) {
+        remove(temp.c_str());
+        return false;
+    }
+#endif
+    return true;
+}
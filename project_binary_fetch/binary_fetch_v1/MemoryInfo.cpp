@@ -1,19 +1,24 @@
-#include "include\MemoryInfo.h"
+#include "include/MemoryInfo.h"
+#include "include/StaticCache.h"
+#include "include/SMBIOSParser.h"
+#ifdef _WIN32
 #include <windows.h>
-#include <comdef.h>
-#include <Wbemidl.h>
+#else
+#include "include/LinuxSysfs.h"
+#include <cstdlib>
+#include <cstring>
+#endif
 #include <iostream>
 #include <iomanip>
 #include <string>
 using namespace std;
 
-#pragma comment(lib, "wbemuuid.lib")
-
 MemoryInfo::MemoryInfo() {
     fetchSystemMemory();
     fetchModulesInfo();
 }
 
+#ifdef _WIN32
 void MemoryInfo::fetchSystemMemory() {
     MEMORYSTATUSEX status;
     status.dwLength = sizeof(status);
@@ -27,202 +32,36 @@ void MemoryInfo::fetchSystemMemory() {
         freeGB = 0;
     }
 }
+#else
+// MemTotal / MemAvailable (kB) from /proc/meminfo, same rounding as above
+void MemoryInfo::fetchSystemMemory() {
+    string meminfo = sysfs_read_all("/proc/meminfo");
+    auto field = [&](const char* name) -> unsigned long long {
+        size_t pos = meminfo.find(name);
+        if (pos == string::npos) return 0;
+        return strtoull(meminfo.c_str() + pos + strlen(name), nullptr, 10) * 1024;
+    };
+    unsigned long long total = field("MemTotal:");
+    unsigned long long avail = field("MemAvailable:");
+    totalGB = static_cast<int>((total + (1024 * 1024 * 1024) - 1) / (1024 * 1024 * 1024));
+    freeGB = static_cast<int>(avail / (1024 * 1024 * 1024));
+}
+#endif
 
+// The module list can't change without a reboot -> StaticCache.
+// On a cold cache the SMBIOS type 17 records replace the old WMI walk.
 void MemoryInfo::fetchModulesInfo() {
-    // Initialize COM
-    HRESULT hres = CoInitializeEx(0, COINIT_MULTITHREADED);
-    if (FAILED(hres)) return;
-
-    hres = CoInitializeSecurity(
-        NULL, -1, NULL, NULL,
-        RPC_C_AUTHN_LEVEL_DEFAULT,
-        RPC_C_IMP_LEVEL_IMPERSONATE,
-        NULL, EOAC_NONE, NULL
-    );
-    if (FAILED(hres)) {
-        CoUninitialize();
-        return;
-    }
-
-    IWbemLocator* pLoc = NULL;
-    hres = CoCreateInstance(
-        CLSID_WbemLocator, 0, CLSCTX_INPROC_SERVER,
-        IID_IWbemLocator, (LPVOID*)&pLoc
-    );
-    if (FAILED(hres)) {
-        CoUninitialize();
-        return;
-    }
-
-    IWbemServices* pSvc = NULL;
-    hres = pLoc->ConnectServer(
-        _bstr_t(L"ROOT\\CIMV2"),
-        NULL, NULL, 0, NULL, 0, 0, &pSvc
-    );
-    if (FAILED(hres)) {
-        pLoc->Release();
-        CoUninitialize();
-        return;
-    }
-
-    hres = CoSetProxyBlanket(
-        pSvc,
-        RPC_C_AUTHN_WINNT,
-        RPC_C_AUTHZ_NONE,
-        NULL,
-        RPC_C_AUTHN_LEVEL_CALL,
-        RPC_C_IMP_LEVEL_IMPERSONATE,
-        NULL,
-        EOAC_NONE
-    );
-    if (FAILED(hres)) {
-        pSvc->Release();
-        pLoc->Release();
-        CoUninitialize();
-        return;
-    }
-
-    IEnumWbemClassObject* pEnumerator = NULL;
-    // Get more properties including SMBIOSMemoryType which is more reliable
-    hres = pSvc->ExecQuery(
-        bstr_t("WQL"),
-        bstr_t("SELECT Capacity, Speed, SMBIOSMemoryType, Manufacturer, PartNumber FROM Win32_PhysicalMemory"),
-        WBEM_FLAG_FORWARD_ONLY | WBEM_FLAG_RETURN_IMMEDIATELY,
-        NULL, &pEnumerator
-    );
-
-    if (FAILED(hres)) {
-        pSvc->Release();
-        pLoc->Release();
-        CoUninitialize();
-        return;
-    }
-
-    IWbemClassObject* pclsObj = NULL;
-    ULONG uReturn = 0;
-
-    while (pEnumerator) {
-        HRESULT hr = pEnumerator->Next(WBEM_INFINITE, 1, &pclsObj, &uReturn);
-        if (0 == uReturn) break;
-
-        VARIANT vtProp;
-        MemoryModule module;
-
-        // Capacity in bytes -> GB
-        hr = pclsObj->Get(L"Capacity", 0, &vtProp, 0, 0);
-        if (SUCCEEDED(hr)) {
-            unsigned long long bytes = 0;
-            if (vtProp.vt == VT_BSTR) {
-                bytes = _wtoi64(vtProp.bstrVal);
-            }
-            else if (vtProp.vt == VT_I8 || vtProp.vt == VT_UI8) {
-                bytes = vtProp.ullVal;
-            }
-            else if (vtProp.vt == VT_I4 || vtProp.vt == VT_UI4) {
-                bytes = vtProp.uintVal;
-            }
-
-            if (bytes > 0) {
-                int gb = static_cast<int>(bytes / (1024 * 1024 * 1024));
-                // Handle cases where GB might not divide evenly
-                if (bytes % (1024 * 1024 * 1024) != 0) {
-                    gb++;  // Round up to nearest GB
-                }
-                module.capacity = to_string(gb) + "GB";
-            }
-            else {
-                module.capacity = "Unknown";
-            }
-        }
-        else {
-            module.capacity = "Unknown";
-        }
-        VariantClear(&vtProp);
-
-        // Speed
-        hr = pclsObj->Get(L"Speed", 0, &vtProp, 0, 0);
-        if (SUCCEEDED(hr)) {
-            if (vtProp.vt == VT_I4 || vtProp.vt == VT_UI4) {
-                module.speed = to_string(vtProp.uintVal) + " MHz";
-            }
-            else if (vtProp.vt == VT_BSTR) {
-                // Convert BSTR to string
-                wstring ws(vtProp.bstrVal);
-                string speedStr(ws.begin(), ws.end());
-                module.speed = speedStr + " MHz";
-            }
-            else {
-                module.speed = "Unknown MHz";
-            }
-        }
-        else {
-            module.speed = "Unknown MHz";
-        }
-        VariantClear(&vtProp);
-
-        // Try SMBIOSMemoryType first (more reliable)
-        hr = pclsObj->Get(L"SMBIOSMemoryType", 0, &vtProp, 0, 0);
-        if (SUCCEEDED(hr) && vtProp.vt != VT_NULL) {
-            switch (vtProp.uintVal) {
-            case 26: module.type = "DDR4"; break;        // 0x1A
-            case 24: module.type = "DDR3"; break;        // 0x18
-            case 27: module.type = "DDR5"; break;        // 0x1B
-            case 20: module.type = "DDR"; break;         // 0x14
-            case 21: module.type = "DDR2"; break;        // 0x15
-            case 19: module.type = "DDR2-FB-DIMM"; break;// 0x13
-
-            default:
-            {
-                VARIANT vtProp2;
-                HRESULT hr2 = pclsObj->Get(L"MemoryType", 0, &vtProp2, 0, 0);
-                if (SUCCEEDED(hr2) && vtProp2.vt != VT_NULL) {
-                    switch (vtProp2.uintVal) {
-                    case 24: module.type = "DDR3"; break;
-                    case 26: module.type = "DDR4"; break;
-                    case 20: module.type = "DDR"; break;
-                    case 21: module.type = "DDR2"; break;
-                    case 27: module.type = "DDR5"; break;
-                    default: module.type = "Unknown"; break;
-                    }
-                }
-                else {
-                    module.type = "Unknown";
-                }
-                VariantClear(&vtProp2);
-            }
-            break;
-            }
+    vector<StaticCache::Record> records = StaticCache::instance().records("memory.modules", [] {
+        vector<StaticCache::Record> out;
+        for (const auto& m : smbios_system().modules) {
+            out.push_back({ {"capacity", m.capacity}, {"type", m.type}, {"speed", m.speed} });
         }
+        return out;
+        });
 
-        else {
-            // Fallback to MemoryType
-            VARIANT vtProp2;
-            hr = pclsObj->Get(L"MemoryType", 0, &vtProp2, 0, 0);
-            if (SUCCEEDED(hr) && vtProp2.vt != VT_NULL) {
-                switch (vtProp2.uintVal) {
-                case 24: module.type = "DDR3"; break;
-                case 26: module.type = "DDR4"; break;
-                case 20: module.type = "DDR"; break;
-                case 21: module.type = "DDR2"; break;
-                case 27: module.type = "DDR5"; break;
-                default: module.type = "Unknown"; break;
-                }
-            }
-            else {
-                module.type = "Unknown";
-            }
-            VariantClear(&vtProp2);
-        }
-        VariantClear(&vtProp);
-
-        modules.push_back(module);
-        pclsObj->Release();
+    for (auto& r : records) {
+        modules.push_back({ r["capacity"], r["type"], r["speed"] });
     }
-
-    pEnumerator->Release();
-    pSvc->Release();
-    pLoc->Release();
-    CoUninitialize();
 }
 
 int MemoryInfo::getTotal() const { return totalGB; }
@@ -1,4 +1,10 @@
-﻿#include "include\NetworkInfo.h"
+﻿#include "include/NetworkInfo.h"
+#include "include/FactStore.h"
+#include "include/BenchmarkCache.h"
+
+// Windows only - the Linux implementation lives in NetworkInfoLinux.cpp
+#ifdef _WIN32
+
 #include <WinSock2.h>
 #include <iphlpapi.h>
 #include <WS2tcpip.h>
@@ -7,10 +13,10 @@
 #include <iomanip>
 #include <sstream>
 #include <netioapi.h>
-#include <wlanapi.h>
 #include <winhttp.h>
 #include <algorithm>
 #include <vector>
+#include <functional>
 #include <chrono>
 
 #define WINVER 0x0600
@@ -18,7 +24,6 @@
 
 #pragma comment(lib, "iphlpapi.lib")
 #pragma comment(lib, "ws2_32.lib")
-#pragma comment(lib, "wlanapi.lib")
 #pragma comment(lib, "winhttp.lib")
 
 using namespace std;
@@ -112,44 +117,9 @@ string NetworkInfo::get_locale()
 //-----------------------------------------get_network_name--------------------------------//
 string NetworkInfo::get_network_name()
 {
-	string ssid_str = "Unknown";
-	HANDLE hClient = NULL;
-	DWORD dwMaxClient = 2;
-	DWORD dwCurVersion = 0;
-
-	if (WlanOpenHandle(dwMaxClient, NULL, &dwCurVersion, &hClient) != ERROR_SUCCESS)
-		return ssid_str;
-
-	PWLAN_INTERFACE_INFO_LIST pIfList = NULL;
-	if (WlanEnumInterfaces(hClient, NULL, &pIfList) != ERROR_SUCCESS)
-	{
-		WlanCloseHandle(hClient, NULL);
-		return ssid_str;
-	}
-
-	for (DWORD i = 0; i < pIfList->dwNumberOfItems; ++i)
-	{
-		PWLAN_INTERFACE_INFO pIfInfo = &pIfList->InterfaceInfo[i];
-		PWLAN_AVAILABLE_NETWORK_LIST pBssList = NULL;
-
-		if (WlanGetAvailableNetworkList(hClient, &pIfInfo->InterfaceGuid, 0, NULL, &pBssList) == ERROR_SUCCESS)
-		{
-			for (DWORD j = 0; j < pBssList->dwNumberOfItems; ++j)
-			{
-				const auto& net = pBssList->Network[j];
-				if (net.dwFlags & WLAN_AVAILABLE_NETWORK_CONNECTED)
-				{
-					ssid_str = string((char*)net.dot11Ssid.ucSSID, net.dot11Ssid.uSSIDLength);
-					break;
-				}
-			}
-			if (pBssList) WlanFreeMemory(pBssList);
-		}
-	}
-
-	if (pIfList) WlanFreeMemory(pIfList);
-	WlanCloseHandle(hClient, NULL);
-	return ssid_str;
+	// connected SSID, shared with CompactNetwork (one WLAN query per run)
+	string ssid_str = FactStore::wifiSsid();
+	return ssid_str.empty() ? "Unknown" : ssid_str;
 }
 
 //-----------------------------------------get_public_ip--------------------------------//
@@ -219,13 +189,69 @@ static string format_speed(double mbps)
 	return oss.str();
 }
 
-//-----------------------------------------get_network_download_speed--------------------------------//
+//-----------------------------------------HELPER: Link identity--------------------------------//
+/**
+ * What a speed test result is cached under: the interface the default route
+ * leaves by and the router behind it, both by MAC ("A4:B1:...>00:11:...").
+ * Another network (or the same laptop on another WiFi) is another key.
+ * @return "" when there is no gateway (nothing to measure against)
+ */
+static string link_identity()
+{
+	// the route to any public address (1.1.1.1) is the default route
+	MIB_IPFORWARDROW route;
+	if (GetBestRoute(htonl(0x01010101), 0, &route) != NO_ERROR || route.dwForwardNextHop == 0)
+		return "";
+
+	// the gateway is in the ARP cache already: the route is in use
+	ULONG gateway[2] = { 0 };
+	ULONG gateway_len = 6;
+	if (SendARP(route.dwForwardNextHop, 0, gateway, &gateway_len) != NO_ERROR || gateway_len != 6)
+		return "";
+
+	MIB_IF_ROW2 row{};
+	row.InterfaceIndex = route.dwForwardIfIndex;
+	if (GetIfEntry2(&row) != NO_ERROR)
+		return "";
+
+	auto format_mac = [](const BYTE* mac, ULONG len) {
+		ostringstream oss;
+		for (ULONG i = 0; i < len; ++i)
+			oss << (i ? ":" : "") << hex << uppercase << setw(2) << setfill('0') << (int)mac[i];
+		return oss.str();
+	};
+	return format_mac(row.PhysicalAddress, row.PhysicalAddressLength) + ">"
+		+ format_mac(reinterpret_cast<const BYTE*>(gateway), 6);
+}
+
+//-----------------------------------------HELPER: Cached speed test--------------------------------//
+/**
+ * A result measured over the same link on an earlier run, while fresh, comes
+ * from BenchmarkCache with its age ("45.3 Mbps (3h ago)"); otherwise the test
+ * runs and a successful result is stored.
+ */
+static string cached_speed(const string& test, const function<string()>& measure)
+{
+	string link = link_identity();
+	string key = link.empty() ? "" : "net:" + link + ":" + test;
+	string value;
+	long long age = 0;
+	if (BenchmarkCache::instance().text(key, value, age))
+		return value + " (" + BenchmarkCache::formatAge(age) + " ago)";
+
+	value = measure();
+	if (value != "Unknown")
+		BenchmarkCache::instance().storeText(key, value);
+	return value;
+}
+
+//-----------------------------------------measure_download_speed--------------------------------//
 /**
  * Measures actual download speed by downloading test data
  * Uses a fast, lightweight test (downloads ~1-2MB)
  * @return Formatted speed string (e.g., "45.3 Mbps", "1.2 Gbps")
  */
-string NetworkInfo::get_network_download_speed()
+static string measure_download_speed()
 {
 	string speed_str = "Unknown";
 
@@ -311,13 +337,13 @@ string NetworkInfo::get_network_download_speed()
 	return speed_str;
 }
 
-//-----------------------------------------get_network_upload_speed--------------------------------//
+//-----------------------------------------measure_upload_speed--------------------------------//
 /**
  * Measures actual upload speed by uploading test data
  * Uses a fast, lightweight test (uploads ~500KB)
  * @return Formatted speed string (e.g., "23.5 Mbps", "890 Kbps")
  */
-string NetworkInfo::get_network_upload_speed()
+static string measure_upload_speed()
 {
 	string speed_str = "Unknown";
 
@@ -400,6 +426,17 @@ string NetworkInfo::get_network_upload_speed()
 	return speed_str;
 }
 
+//-----------------------------------------get_network_download_speed / upload--------------------------------//
+string NetworkInfo::get_network_download_speed()
+{
+	return cached_speed("download", measure_download_speed);
+}
+
+string NetworkInfo::get_network_upload_speed()
+{
+	return cached_speed("upload", measure_upload_speed);
+}
+
 /*
 ================================================================================
 				NETWORK SPEED FUNCTIONS DOCUMENTATION
@@ -421,6 +458,10 @@ NEW FUNCTIONS:
    - Fast execution (~1-2 seconds)
    - Returns: "23.5 Mbps", "890 Kbps", "1.1 Gbps"
 
+   Both are cached in BinaryFetch_Bench.json per link (interface MAC +
+   gateway MAC, see BenchmarkCache.h): while the result is fresh it is
+   shown with its age, "85.3 Mbps (3h ago)", and no test runs.
+
 FEATURES:
 - Uses Cloudflare's speed test infrastructure (fast, reliable)
 - 5-second timeout to prevent hanging
@@ -434,4 +475,6 @@ EXAMPLE OUTPUTS:
 - Low-speed: "450 Kbps"
 
 ================================================================================
-*/
\ No newline at end of file
+*/
+
+#endif // _WIN32
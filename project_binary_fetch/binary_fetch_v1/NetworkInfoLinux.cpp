@@ -0,0 +1,90 @@
+/*
+================================================================================
+ NetworkInfoLinux.cpp — NetworkInfo for Linux
+================================================================================
+
+The Windows version walks GetAdaptersAddresses and takes the first adapter
+that is up. Here every answer comes from the shared netlink snapshot
+(FactStore::network(), see LinuxNetlink.h): one dump of links, addresses and
+routes per run, and the interface shown is the one carrying the default
+route - the one traffic actually leaves through.
+================================================================================
+*/
+#include "include/NetworkInfo.h"
+
+#ifndef _WIN32
+#include "include/FactStore.h"
+
+#include <cstdlib>
+#include <sys/socket.h>
+using namespace std;
+
+// first IPv4 of the active interface, null if there is none
+static const NetAddress* active_ipv4(const NetSnapshot& net) {
+	const NetInterface* nic = net.active();
+	if (!nic) return nullptr;
+	for (const auto& a : nic->addresses) {
+		if (a.family == AF_INET) return &a;
+	}
+	return nullptr;
+}
+
+//-----------------------------------------get_local_ip--------------------------------//
+string NetworkInfo::get_local_ip()
+{
+	NetSnapshot net = FactStore::network();
+	const NetAddress* a = active_ipv4(net);
+	return a ? a->address + "/" + to_string(a->prefix) : "Unknown";
+}
+
+//-----------------------------------------get_mac_address--------------------------------//
+string NetworkInfo::get_mac_address()
+{
+	NetSnapshot net = FactStore::network();
+	const NetInterface* nic = net.active();
+	return (nic && !nic->mac.empty()) ? nic->mac : "Unknown";
+}
+
+//-----------------------------------------get_locale--------------------------------//
+string NetworkInfo::get_locale()
+{
+	// "en_US.UTF-8@euro" -> "en-US", the Windows locale name format
+	const char* vars[] = { "LC_ALL", "LC_MESSAGES", "LANG" };
+	for (const char* var : vars) {
+		const char* value = getenv(var);
+		if (!value || !*value) continue;
+
+		string locale = value;
+		locale = locale.substr(0, locale.find_first_of(".@"));
+		if (locale == "C" || locale == "POSIX") return "Unknown";
+		for (char& c : locale) if (c == '_') c = '-';
+		return locale;
+	}
+	return "Unknown";
+}
+
+//-----------------------------------------get_network_name--------------------------------//
+string NetworkInfo::get_network_name()
+{
+	string ssid_str = FactStore::wifiSsid();
+	return ssid_str.empty() ? "Unknown" : ssid_str;
+}
+
+//-----------------------------------------public ip / speed tests--------------------------------//
+// These need an HTTP client (WinHTTP on Windows); not available on Linux yet.
+string NetworkInfo::get_public_ip()
+{
+	return "Unknown";
+}
+
+string NetworkInfo::get_network_download_speed()
+{
+	return "Unknown";
+}
+
+string NetworkInfo::get_network_upload_speed()
+{
+	return "Unknown";
+}
+
+#endif
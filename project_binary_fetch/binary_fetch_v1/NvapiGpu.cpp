@@ -0,0 +1,25 @@
+#include "include/NvapiGpu.h"
+#include <windows.h>
+using namespace std;
+#pragma comment(lib, "nvapi64.lib")
+
+// -------------------- Helpers --------------------
+static bool isNvapiAvailable() {
+    HMODULE hNvapi = LoadLibraryA("nvapi64.dll");
+    if (!hNvapi) return false;
+    FreeLibrary(hNvapi);
+    return true;
+}
+
+NvPhysicalGpuHandle nvapiFirstGpu() {
+    static const NvPhysicalGpuHandle gpu = [] {
+        NvPhysicalGpuHandle handle = nullptr;
+        if (!isNvapiAvailable() || NvAPI_Initialize() != NVAPI_OK) return handle;
+        NvPhysicalGpuHandle handles[NVAPI_MAX_PHYSICAL_GPUS];
+        NvU32 count = 0;
+        if (NvAPI_EnumPhysicalGPUs(handles, &count) == NVAPI_OK && count > 0) handle = handles[0];
+        else NvAPI_Unload();
+        return handle;
+    }();
+    return gpu;
+}
@@ -1,4 +1,6 @@
-#include "include\OSInfo.h"
+#include "include/OSInfo.h"
+#include "include/FactStore.h"
+#include "include/StaticCache.h"
 #include <Windows.h>
 #include <VersionHelpers.h>
 #include <comdef.h>
@@ -164,7 +166,7 @@ string OSInfo::get_os_serial_number()
 string OSInfo::get_os_uptime()
 {
     // Get the number of milliseconds since the system started
-    ULONGLONG ms = GetTickCount64();
+    ULONGLONG ms = FactStore::uptimeMs();
 
     // Convert milliseconds to total seconds
     ULONGLONG total_seconds = ms / 1000;
@@ -216,7 +218,7 @@ string OSInfo::get_os_uptime()
 
 
 //function to get os install date-------------------------------------------------------------------------------------------
-string OSInfo::get_os_install_date()
+static string query_os_install_date()
 {
     HRESULT hres;
     hres = CoInitializeEx(0, COINITBASE_MULTITHREADED);
@@ -290,6 +292,16 @@ string OSInfo::get_os_install_date()
 
 }
 
+string OSInfo::get_os_install_date()
+{
+    // only changes with a reinstall (= a reboot) -> StaticCache
+    string date = StaticCache::instance().text("os.install_date", [] {
+        string value = query_os_install_date();
+        return value == "Unknown" ? string() : value;
+        });
+    return date.empty() ? "Unknown" : date;
+}
+
 //get os kernel version (major.major.build)
 string OSInfo::get_os_kernel_info()
 {
@@ -1,21 +1,11 @@
-#include "include\PerformanceInfo.h"
-#include <pdhmsg.h>
-#include <thread>
-#include <chrono>
+#include "include/PerformanceInfo.h"
+#include "include/UtilizationSampler.h"
+#include "include/FactStore.h"
 #include <vector>
-#include "nvapi.h"
+#include "include/NvapiGpu.h"
 using namespace std;
-#pragma comment(lib, "pdh.lib")
 #pragma comment(lib, "nvapi64.lib")
 
-// -------------------- Helpers --------------------
-static bool isNvapiAvailable() {
-    HMODULE hNvapi = LoadLibraryA("nvapi64.dll");
-    if (!hNvapi) return false;
-    FreeLibrary(hNvapi);
-    return true;
-}
-
 // NVAPI Utilization Enum (in case header is old)
 #ifndef NVAPI_GPU_UTILIZATION_GPU
 enum NV_GPU_UTILIZATION {
@@ -27,46 +17,6 @@ enum NV_GPU_UTILIZATION {
 };
 #endif
 
-// -------------------- Impl --------------------
-struct PerformanceInfo::Impl {
-    PDH_HQUERY cpuQuery;
-    PDH_HCOUNTER cpuTotal;
-    bool cpuInitialized;
-
-    Impl() : cpuQuery(nullptr), cpuTotal(nullptr), cpuInitialized(false) {}
-};
-
-// -------------------- Constructor --------------------
-PerformanceInfo::PerformanceInfo() {
-    pImpl = new Impl();
-
-    // CPU initialization
-    PDH_STATUS status = PdhOpenQuery(NULL, 0, &pImpl->cpuQuery);
-    if (status == ERROR_SUCCESS) {
-        status = PdhAddCounter(pImpl->cpuQuery, TEXT("\\Processor(_Total)\\% Processor Time"), 0, &pImpl->cpuTotal);
-        if (status == ERROR_SUCCESS) {
-            PdhCollectQueryData(pImpl->cpuQuery); // prime
-            pImpl->cpuInitialized = true;
-        }
-        else {
-            PdhCloseQuery(pImpl->cpuQuery);
-            pImpl->cpuQuery = nullptr;
-            pImpl->cpuInitialized = false;
-        }
-    }
-}
-
-// -------------------- Destructor --------------------
-PerformanceInfo::~PerformanceInfo() {
-    if (pImpl) {
-        if (pImpl->cpuInitialized && pImpl->cpuQuery) {
-            PdhCloseQuery(pImpl->cpuQuery);
-        }
-        delete pImpl;
-        pImpl = nullptr;
-    }
-}
-
 // -------------------- Uptime --------------------
 std::string PerformanceInfo::format_uptime(unsigned long long totalMilliseconds) {
     unsigned long long totalSeconds = totalMilliseconds / 1000ULL;
@@ -77,26 +27,20 @@ std::string PerformanceInfo::format_uptime(unsigned long long totalMilliseconds)
 }
 
 std::string PerformanceInfo::get_system_uptime() {
-    return format_uptime(GetTickCount64());
+    return format_uptime(FactStore::uptimeMs());
 }
 
 // -------------------- CPU Usage --------------------
 float PerformanceInfo::get_cpu_usage_percent() {
-    if (!pImpl || !pImpl->cpuInitialized) return 0.0f;
-
-    PDH_FMT_COUNTERVALUE counterVal;
-    PdhCollectQueryData(pImpl->cpuQuery);
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    PdhCollectQueryData(pImpl->cpuQuery);
-
-    if (PdhGetFormattedCounterValue(pImpl->cpuTotal, PDH_FMT_DOUBLE, NULL, &counterVal) != ERROR_SUCCESS) {
-        return 0.0f;
-    }
+    // shared sampling window (see UtilizationSampler)
+    return static_cast<float>(UtilizationSampler::instance().cpuPercent());
+}
 
-    double val = counterVal.doubleValue;
-    if (val < 0.0) val = 0.0;
-    if (val > 100.0) val = 100.0;
-    return static_cast<float>(val);
+// one entry per logical processor, same window as the total
+vector<float> PerformanceInfo::get_cpu_core_usage_percent() {
+    vector<float> result;
+    for (double core : UtilizationSampler::instance().perCorePercent()) result.push_back(static_cast<float>(core));
+    return result;
 }
 
 // -------------------- RAM Usage --------------------
@@ -118,50 +62,26 @@ float PerformanceInfo::get_disk_usage_percent() {
     return static_cast<float>(used * 100.0);
 }
 
+// busy time of the physical disks over the sampling window
+// ("disk_usage_mode": "busy")
+float PerformanceInfo::get_disk_busy_percent() {
+    double usage = UtilizationSampler::instance().diskPercent();
+    return (usage >= 0.0) ? static_cast<float>(usage) : 0.0f;
+}
+
 // -------------------- GPU Usage --------------------
 float PerformanceInfo::get_gpu_usage_percent() {
     // --- NVIDIA via NVAPI ---
-    if (isNvapiAvailable() && NvAPI_Initialize() == NVAPI_OK) {
-        NvPhysicalGpuHandle gpuHandles[64];
-        NvU32 gpuCount = 0;
-
-        if (NvAPI_EnumPhysicalGPUs(gpuHandles, &gpuCount) == NVAPI_OK && gpuCount > 0) {
-            NV_GPU_DYNAMIC_PSTATES_INFO_EX dynStates = {};
-            dynStates.version = NV_GPU_DYNAMIC_PSTATES_INFO_EX_VER;
+    if (NvPhysicalGpuHandle gpu = nvapiFirstGpu()) {
+        NV_GPU_DYNAMIC_PSTATES_INFO_EX dynStates = {};
+        dynStates.version = NV_GPU_DYNAMIC_PSTATES_INFO_EX_VER;
 
-            if (NvAPI_GPU_GetDynamicPstatesInfoEx(gpuHandles[0], &dynStates) == NVAPI_OK) {
-                NvAPI_Unload();
-                return static_cast<float>(dynStates.utilization[NVAPI_GPU_UTILIZATION_GPU].percentage);
-            }
+        if (NvAPI_GPU_GetDynamicPstatesInfoEx(gpu, &dynStates) == NVAPI_OK) {
+            return static_cast<float>(dynStates.utilization[NVAPI_GPU_UTILIZATION_GPU].percentage);
         }
-        NvAPI_Unload();
-    }
-
-    // --- Non-NVIDIA: PDH GPU Engine (_3D) ---
-    PDH_HQUERY query;
-    PDH_HCOUNTER counter;
-    PDH_FMT_COUNTERVALUE value;
-
-    if (PdhOpenQuery(nullptr, 0, &query) != ERROR_SUCCESS) return 0.0f;
-
-    std::vector<std::wstring> engines = { L"\\GPU Engine(*_3D)\\Utilization Percentage" };
-    int total = 0, count = 0;
-
-    for (auto& eng : engines) {
-        if (PdhAddEnglishCounter(query, eng.c_str(), 0, &counter) != ERROR_SUCCESS) continue;
-
-        PdhCollectQueryData(query);
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        PdhCollectQueryData(query);
-
-        if (PdhGetFormattedCounterValue(counter, PDH_FMT_LONG, nullptr, &value) == ERROR_SUCCESS) {
-            total += value.longValue;
-            count++;
-        }
-
-        PdhRemoveCounter(counter);
     }
 
-    PdhCloseQuery(query);
-    return (count > 0) ? static_cast<float>(total / count) : 0.0f;
+    // --- Non-NVIDIA: PDH GPU Engine (_3D), sampled by UtilizationSampler ---
+    double usage = UtilizationSampler::instance().gpuPercent();
+    return (usage >= 0.0) ? static_cast<float>(usage) : 0.0f;
 }
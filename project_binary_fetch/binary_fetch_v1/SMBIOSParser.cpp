@@ -0,0 +1,214 @@
+#include "include/SMBIOSParser.h"
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// -------------------- Byte helpers --------------------
+// SMBIOS is little endian and unaligned, read byte by byte
+
+static unsigned read_word(const unsigned char* p) {
+    return p[0] | (p[1] << 8);
+}
+
+static unsigned long read_dword(const unsigned char* p) {
+    return static_cast<unsigned long>(read_word(p)) | (static_cast<unsigned long>(read_word(p + 2)) << 16);
+}
+
+static unsigned long long read_qword(const unsigned char* p) {
+    return static_cast<unsigned long long>(read_dword(p)) | (static_cast<unsigned long long>(read_dword(p + 4)) << 32);
+}
+
+// string number <index> (1-based) of the string set that starts at <strings>
+static string structure_string(const unsigned char* strings, const unsigned char* end, unsigned index) {
+    if (index == 0) return "";
+    const unsigned char* p = strings;
+    for (unsigned i = 1; p < end && *p; ++i) {
+        const unsigned char* s = p;
+        while (p < end && *p) ++p;
+        if (i == index) {
+            string value(reinterpret_cast<const char*>(s), static_cast<size_t>(p - s));
+            while (!value.empty() && value.back() == ' ') value.pop_back();
+            return value;
+        }
+        ++p;
+    }
+    return "";
+}
+
+// SMBIOS 3.x, 7.18.2 Memory Device - Type
+static string memory_type_name(unsigned type) {
+    switch (type) {
+    case 0x0F: return "SDRAM";
+    case 0x12: return "DDR";
+    case 0x13: return "DDR2";
+    case 0x14: return "DDR2-FB-DIMM";
+    case 0x18: return "DDR3";
+    case 0x1A: return "DDR4";
+    case 0x1B: return "LPDDR";
+    case 0x1C: return "LPDDR2";
+    case 0x1D: return "LPDDR3";
+    case 0x1E: return "LPDDR4";
+    case 0x20: return "HBM";
+    case 0x21: return "HBM2";
+    case 0x22: return "DDR5";
+    case 0x23: return "LPDDR5";
+    case 0x24: return "HBM3";
+    default:   return "Unknown";
+    }
+}
+
+// Type 17, populated devices only (size 0 = empty slot)
+static bool parse_memory_device(const unsigned char* s, unsigned length, MemoryModule& module) {
+    if (length < 0x15) return false;
+
+    unsigned size = read_word(s + 0x0C);
+    if (size == 0) return false;
+
+    unsigned long long kb = 0;
+    if (size == 0x7FFF && length >= 0x20) kb = (read_dword(s + 0x1C) & 0x7FFFFFFFUL) * 1024ULL; // >= 32 GB, in MB
+    else if (size != 0xFFFF) kb = (size & 0x8000) ? (size & 0x7FFF) : size * 1024ULL;         // bit 15 = KB units
+
+    // rounded up to whole GB like the WMI version did
+    module.capacity = kb > 0 ? to_string((kb + 1024 * 1024 - 1) / (1024 * 1024)) + "GB" : "Unknown";
+    module.type = memory_type_name(s[0x12]);
+
+    unsigned long speed = 0;
+    if (length >= 0x17) speed = read_word(s + 0x15);
+    if (speed == 0xFFFF && length >= 0x58) speed = read_dword(s + 0x54);             // 3.3+ extended speed
+    module.speed = (speed > 0 && speed != 0xFFFF) ? to_string(speed) + " MHz" : "Unknown MHz";
+    return true;
+}
+
+// -------------------- Parsers --------------------
+
+bool smbios_parse_entry_point(const unsigned char* data, size_t size, SMBIOSEntryPoint& out) {
+    if (!data) return false;
+
+    if (size >= 0x18 && memcmp(data, "_SM3_", 5) == 0) {
+        out.majorVersion = data[0x07];
+        out.minorVersion = data[0x08];
+        out.tableLength = read_dword(data + 0x0C);
+        out.tableAddress = read_qword(data + 0x10);
+        return true;
+    }
+    if (size >= 0x1F && memcmp(data, "_SM_", 4) == 0 && memcmp(data + 0x10, "_DMI_", 5) == 0) {
+        out.majorVersion = data[0x06];
+        out.minorVersion = data[0x07];
+        out.tableLength = read_word(data + 0x16);
+        out.tableAddress = read_dword(data + 0x18);
+        return true;
+    }
+    return false;
+}
+
+SMBIOSInfo smbios_parse_table(const unsigned char* table, size_t size, int major, int minor) {
+    SMBIOSInfo info;
+    info.majorVersion = major;
+    info.minorVersion = minor;
+    if (!table) return info;
+
+    bool haveBios = false;
+    bool haveBoard = false;
+    size_t offset = 0;
+
+    while (offset + 4 <= size) {
+        const unsigned char* s = table + offset;
+        unsigned type = s[0];
+        unsigned length = s[1];
+        if (length < 4 || offset + length > size) break;
+
+        // the string set ends with a double NUL (just "\0\0" if empty)
+        size_t next = offset + length;
+        while (next + 1 < size && !(table[next] == 0 && table[next + 1] == 0)) ++next;
+        if (next + 1 >= size) break;
+        const unsigned char* strings = s + length;
+        const unsigned char* stringsEnd = table + next + 1;
+        next += 2;
+
+        info.valid = true;
+
+        if (type == 0 && !haveBios && length >= 0x09) {
+            info.biosVendor = structure_string(strings, stringsEnd, s[0x04]);
+            info.biosVersion = structure_string(strings, stringsEnd, s[0x05]);
+            info.biosDate = structure_string(strings, stringsEnd, s[0x08]);
+            haveBios = true;
+        }
+        else if (type == 2 && !haveBoard && length >= 0x06) {
+            info.boardManufacturer = structure_string(strings, stringsEnd, s[0x04]);
+            info.boardModel = structure_string(strings, stringsEnd, s[0x05]);
+            haveBoard = true;
+        }
+        else if (type == 16 && length >= 0x0F) {
+            if (s[0x05] == 0x03) info.slotsTotal += read_word(s + 0x0D);   // use: system memory
+        }
+        else if (type == 17) {
+            MemoryModule module;
+            if (parse_memory_device(s, length, module)) {
+                info.modules.push_back(module);
+                info.slotsUsed++;
+            }
+        }
+        else if (type == 127) {
+            break;                                     // end-of-table
+        }
+
+        offset = next;
+    }
+    return info;
+}
+
+SMBIOSInfo smbios_parse_rsmb(const unsigned char* data, size_t size) {
+    // BYTE Used20CallingMethod, Major, Minor, DmiRevision; DWORD Length; table...
+    if (!data || size < 8) return SMBIOSInfo();
+    size_t length = read_dword(data + 4);
+    if (length > size - 8) length = size - 8;
+    return smbios_parse_table(data + 8, length, data[1], data[2]);
+}
+
+// -------------------- This machine --------------------
+
+#ifndef _WIN32
+// whole binary file (the DMI table is a few KB)
+static vector<unsigned char> read_binary_file(const char* path) {
+    vector<unsigned char> data;
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return data;
+
+    unsigned char buf[16384];
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0) data.insert(data.end(), buf, buf + n);
+    close(fd);
+    return data;
+}
+#endif
+
+static SMBIOSInfo read_system_smbios() {
+#ifdef _WIN32
+    UINT size = GetSystemFirmwareTable('RSMB', 0, nullptr, 0);
+    if (size == 0) return SMBIOSInfo();
+
+    vector<unsigned char> raw(size);
+    if (GetSystemFirmwareTable('RSMB', 0, raw.data(), size) != size) return SMBIOSInfo();
+    return smbios_parse_rsmb(raw.data(), raw.size());
+#else
+    // the entry point only adds the version; the table itself is enough
+    SMBIOSEntryPoint ep;
+    vector<unsigned char> entry = read_binary_file("/sys/firmware/dmi/tables/smbios_entry_point");
+    smbios_parse_entry_point(entry.data(), entry.size(), ep);
+
+    vector<unsigned char> table = read_binary_file("/sys/firmware/dmi/tables/DMI");
+    return smbios_parse_table(table.data(), table.size(), ep.majorVersion, ep.minorVersion);
+#endif
+}
+
+const SMBIOSInfo& smbios_system() {
+    static const SMBIOSInfo info = read_system_smbios();
+    return info;
+}
@@ -0,0 +1,260 @@
+#include "include/StaticCache.h"
+#include "nlohmann/json.hpp"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdio>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <intrin.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/sysinfo.h>
+#endif
+
+using namespace std;
+using json = nlohmann::json;
+
+static const int CACHE_FORMAT = 2;     // 2: memory records from SMBIOS (corrected type codes)
+
+struct StaticCache::State {
+    string bootId;
+    string fingerprint;
+    json facts = json::object();
+};
+
+// -------------------- Identity helpers --------------------
+
+// FNV-1a, enough to notice that something changed
+static void fnv1a(unsigned long long& h, const void* data, size_t size) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+}
+
+static string to_hex(unsigned long long v) {
+    ostringstream ss;
+    ss << hex << setw(16) << setfill('0') << v;
+    return ss.str();
+}
+
+#ifdef _WIN32
+// Windows bumps BootId once per boot (Win8+). Older systems fall back to
+// the boot time rounded to the minute, which is stable within one boot.
+static string read_boot_id() {
+    DWORD bootId = 0;
+    DWORD size = sizeof(bootId);
+    if (RegGetValueA(HKEY_LOCAL_MACHINE,
+        "SYSTEM\\CurrentControlSet\\Control\\Session Manager\\Memory Management\\PrefetchParameters",
+        "BootId", RRF_RT_REG_DWORD, nullptr, &bootId, &size) == ERROR_SUCCESS) {
+        return "bootid:" + to_string(bootId);
+    }
+
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    ULARGE_INTEGER t;
+    t.LowPart = now.dwLowDateTime;
+    t.HighPart = now.dwHighDateTime;
+    unsigned long long bootMinute = (t.QuadPart / 10000ULL - GetTickCount64()) / 60000ULL;
+    return "boottime:" + to_string(bootMinute);
+}
+
+static string read_fingerprint() {
+    unsigned long long h = 14695981039346656037ULL;
+
+    int regs[4] = { 0 };
+    __cpuid(regs, 1);                                 // family / model / stepping
+    fnv1a(h, &regs[0], sizeof(regs[0]));
+
+    DWORD threads = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+    fnv1a(h, &threads, sizeof(threads));
+
+    MEMORYSTATUSEX mem;
+    mem.dwLength = sizeof(mem);
+    if (GlobalMemoryStatusEx(&mem)) fnv1a(h, &mem.ullTotalPhys, sizeof(mem.ullTotalPhys));
+
+    // raw SMBIOS tables: BIOS version, board, every DIMM...
+    UINT size = GetSystemFirmwareTable('RSMB', 0, nullptr, 0);
+    if (size > 0) {
+        vector<BYTE> smbios(size);
+        if (GetSystemFirmwareTable('RSMB', 0, smbios.data(), size) == size) fnv1a(h, smbios.data(), smbios.size());
+    }
+
+    return to_hex(h);
+}
+
+#else
+static string read_small_file(const char* path) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return "";
+    char buf[1024];
+    ssize_t n = read(fd, buf, sizeof(buf));
+    close(fd);
+    if (n <= 0) return "";
+    string s(buf, static_cast<size_t>(n));
+    while (!s.empty() && (s.back() == '\n' || s.back() == ' ')) s.pop_back();
+    return s;
+}
+
+static string read_boot_id() {
+    return read_small_file("/proc/sys/kernel/random/boot_id");
+}
+
+static string read_fingerprint() {
+    unsigned long long h = 14695981039346656037ULL;
+
+    long threads = sysconf(_SC_NPROCESSORS_CONF);
+    fnv1a(h, &threads, sizeof(threads));
+
+    struct sysinfo si;
+    if (sysinfo(&si) == 0) {
+        unsigned long long total = static_cast<unsigned long long>(si.totalram) * si.mem_unit;
+        fnv1a(h, &total, sizeof(total));
+    }
+
+    // one line with BIOS vendor/version/date, board and product names
+    string dmi = read_small_file("/sys/class/dmi/id/modalias");
+    fnv1a(h, dmi.data(), dmi.size());
+
+    return to_hex(h);
+}
+#endif
+
+// -------------------- Load / Save --------------------
+StaticCache& StaticCache::instance() {
+    static StaticCache cache;
+    return cache;
+}
+
+StaticCache::StaticCache() : state(new State()), warm(false), dirty(false) {
+}
+
+StaticCache::~StaticCache() {
+    delete state;
+}
+
+void StaticCache::load(const string& directory, bool reuse) {
+    lock_guard<mutex> lock(m);
+#ifdef _WIN32
+    path = directory + "\\BinaryFetch_Cache.json";
+#else
+    path = directory + "/BinaryFetch_Cache.json";
+#endif
+    state->bootId = read_boot_id();
+    state->fingerprint = read_fingerprint();
+    state->facts = json::object();
+    warm = false;
+    if (!reuse) return;
+
+    ifstream in(path);
+    if (!in.is_open()) return;
+
+    try {
+        json file = json::parse(in);
+        if (file.value("format", 0) != CACHE_FORMAT) return;
+        if (file.value("boot_id", "") != state->bootId) return;
+        if (file.value("fingerprint", "") != state->fingerprint) return;
+        if (!file.contains("facts") || !file["facts"].is_object()) return;
+
+        state->facts = file["facts"];
+        warm = true;
+    }
+    catch (...) {
+        // unreadable cache = cold start, it is rewritten by save()
+    }
+}
+
+void StaticCache::save() {
+    lock_guard<mutex> lock(m);
+    if (path.empty() || !dirty) return;
+
+    json file;
+    file["format"] = CACHE_FORMAT;
+    file["boot_id"] = state->bootId;
+    file["fingerprint"] = state->fingerprint;
+    file["facts"] = state->facts;
+
+    // write aside and swap in, so a concurrent run never reads half a file
+    string temp = path + ".tmp";
+    {
+        ofstream out(temp, ios::binary | ios::trunc);
+        if (!out.is_open()) return;
+        out << file.dump(2);
+        if (!out.good()) return;
+    }
+#ifdef _WIN32
+    if (!MoveFileExA(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+        DeleteFileA(temp.c_str());
+        return;
+    }
+#else
+    if (rename(temp.c_str(), path.c_str()) != 0) {
+        remove(temp.c_str());
+        return;
+    }
+#endif
+    dirty = false;
+}
+
+// -------------------- Lookups --------------------
+// The probe runs without the lock held: two sections probing different
+// facts (say RAM modules and the OS install date) must not wait on each other.
+
+string StaticCache::text(const string& key, const function<string()>& probe) {
+    {
+        lock_guard<mutex> lock(m);
+        auto it = state->facts.find(key);
+        if (it != state->facts.end() && it->is_string()) return it->get<string>();
+    }
+
+    string value = probe();
+    if (!value.empty()) {
+        lock_guard<mutex> lock(m);
+        state->facts[key] = value;
+        dirty = true;
+    }
+    return value;
+}
+
+int StaticCache::number(const string& key, const function<int()>& probe) {
+    {
+        lock_guard<mutex> lock(m);
+        auto it = state->facts.find(key);
+        if (it != state->facts.end() && it->is_number_integer()) return it->get<int>();
+    }
+
+    int value = probe();
+    if (value > 0) {
+        lock_guard<mutex> lock(m);
+        state->facts[key] = value;
+        dirty = true;
+    }
+    return value;
+}
+
+vector<StaticCache::Record> StaticCache::records(const string& key, const function<vector<Record>()>& probe) {
+    {
+        lock_guard<mutex> lock(m);
+        auto it = state->facts.find(key);
+        if (it != state->facts.end() && it->is_array()) {
+            try {
+                return it->get<vector<Record>>();
+            }
+            catch (...) {
+                // wrong shape, probe again below
+            }
+        }
+    }
+
+    vector<Record> value = probe();
+    if (!value.empty()) {
+        lock_guard<mutex> lock(m);
+        state->facts[key] = value;
+        dirty = true;
+    }
+    return value;
+}
@@ -10,11 +10,15 @@
 ===============================================================
 */
 
+#include "include/StorageInfo.h"
+
+// Windows only - the Linux implementation lives in StorageInfoLinux.cpp
+#ifdef _WIN32
+
 #ifndef _WIN32_WINNT
 #define _WIN32_WINNT 0x0603  // Windows 8.1 or newer
 #endif
 
-#include "include\StorageInfo.h"
 #include <Windows.h>
 #include <sstream>
 #include <iomanip>
@@ -29,6 +33,7 @@
 #include <devguid.h>
 #include <cfgmgr32.h>
 #include <comdef.h>
+#include <map>
 
 #pragma comment(lib, "setupapi.lib")
 #pragma comment(lib, "cfgmgr32.lib")
@@ -208,158 +213,86 @@ string StorageInfo::get_storage_type(const string&, const string& root_path, boo
 }
 
 // ============================================================
-//  FINAL FIX: Accurate speeds with cache bypass guarantee
+//  Speed test: DiskBenchmark, once per physical disk
 // ============================================================
-static double measure_disk_speed(const string& root_path, bool writeTest) {
-    const size_t BUF_SIZE = 32 * 1024 * 1024; // 32 MB
-
-    // CRITICAL: Align buffer for NO_BUFFERING (4096-byte boundary)
-    void* raw_buffer = _aligned_malloc(BUF_SIZE, 4096);
-    if (!raw_buffer) return 0.0;
-
-    memset(raw_buffer, 0xAA, BUF_SIZE);
-    char* buffer = static_cast<char*>(raw_buffer);
-
-    // Try multiple file locations for compatibility
-    vector<string> testPaths = {
-        root_path + "speed_test_tmp.bin",
-        root_path + "Temp\\speed_test_tmp.bin",
-        root_path + "Users\\Public\\speed_test_tmp.bin"
-    };
-
-    string testFile = testPaths[0];
-
-    // CRITICAL: ALWAYS use NO_BUFFERING for accuracy
-    DWORD flags = FILE_FLAG_NO_BUFFERING | FILE_FLAG_WRITE_THROUGH | FILE_FLAG_SEQUENTIAL_SCAN;
-    HANDLE hFile = INVALID_HANDLE_VALUE;
-    DWORD bytesDone = 0;
-    BOOL ok = FALSE;
-
-    if (writeTest) {
-        // WRITE TEST - Try locations but KEEP NO_BUFFERING
-        for (const auto& path : testPaths) {
-            testFile = path;
-
-            // ONLY try with NO_BUFFERING - don't compromise accuracy
-            hFile = CreateFileA(
-                testFile.c_str(),
-                GENERIC_WRITE,
-                0,
-                nullptr,
-                CREATE_ALWAYS,
-                flags,
-                nullptr
-            );
-
-            if (hFile != INVALID_HANDLE_VALUE) {
-                // Successfully opened with NO_BUFFERING
-                auto start = chrono::high_resolution_clock::now();
-                ok = WriteFile(hFile, buffer, (DWORD)BUF_SIZE, &bytesDone, nullptr);
-                FlushFileBuffers(hFile);
-                auto end = chrono::high_resolution_clock::now();
-
-                SafeCloseHandle(hFile);
-
-                if (ok && bytesDone > 0) {
-                    double seconds = chrono::duration<double>(end - start).count();
-                    if (seconds < 0.001) seconds = 0.001;
-                    _aligned_free(raw_buffer);
-                    return (bytesDone / (1024.0 * 1024.0)) / seconds;
-                }
-            }
-        }
 
-        // If all NO_BUFFERING attempts failed, return 0.0
-        // DO NOT fall back to cached methods
-        _aligned_free(raw_buffer);
-        return 0.0;
-    }
+// "PhysicalDrive<n>" behind the volume, the root itself if unknown
+static string volume_device(const string& root_path) {
+    string volumePath = "\\\\.\\" + string(1, (char)toupper(root_path[0])) + ":";
+    HANDLE hVol = CreateFileA(volumePath.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr, OPEN_EXISTING, 0, nullptr);
+    if (hVol == INVALID_HANDLE_VALUE) return root_path;
 
-    // READ TEST - Same strategy, NO_BUFFERING only
-    for (const auto& path : testPaths) {
-        testFile = path;
+    BYTE buf[512]{};
+    DWORD returned = 0;
+    string device = root_path;
+    if (DeviceIoControl(hVol, IOCTL_VOLUME_GET_VOLUME_DISK_EXTENTS, nullptr, 0, buf, sizeof(buf), &returned, nullptr)) {
+        auto* ext = reinterpret_cast<VOLUME_DISK_EXTENTS*>(buf);
+        if (ext->NumberOfDiskExtents > 0) device = "PhysicalDrive" + to_string(ext->Extents[0].DiskNumber);
+    }
+    SafeCloseHandle(hVol);
+    return device;
+}
 
-        // Try to open existing file with NO_BUFFERING
-        hFile = CreateFileA(
-            testFile.c_str(),
-            GENERIC_READ,
-            FILE_SHARE_READ | FILE_SHARE_WRITE,
-            nullptr,
-            OPEN_EXISTING,
-            flags,
-            nullptr
-        );
+// what the cached speed test of "PhysicalDrive<n>" is filed under: its
+// serial number, else model + size; "" if the drive can't be asked
+static string device_identity(const string& device) {
+    if (device.compare(0, 13, "PhysicalDrive") != 0) return "";
+    HANDLE hDisk = CreateFileA(("\\\\.\\" + device).c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr, OPEN_EXISTING, 0, nullptr);
+    if (hDisk == INVALID_HANDLE_VALUE) return "";
 
-        if (hFile == INVALID_HANDLE_VALUE) {
-            // File doesn't exist, create it first WITH NO_BUFFERING
-            HANDLE hCreate = CreateFileA(
-                testFile.c_str(),
-                GENERIC_WRITE,
-                0,
-                nullptr,
-                CREATE_ALWAYS,
-                flags,  // Use same flags
-                nullptr
-            );
-
-            if (hCreate != INVALID_HANDLE_VALUE) {
-                DWORD written = 0;
-                if (WriteFile(hCreate, buffer, (DWORD)BUF_SIZE, &written, nullptr) && written > 0) {
-                    FlushFileBuffers(hCreate);
-                    SafeCloseHandle(hCreate);
-                    Sleep(100);
-
-                    // Try to open for read with NO_BUFFERING
-                    hFile = CreateFileA(
-                        testFile.c_str(),
-                        GENERIC_READ,
-                        FILE_SHARE_READ | FILE_SHARE_WRITE,
-                        nullptr,
-                        OPEN_EXISTING,
-                        flags,
-                        nullptr
-                    );
-                }
-                else {
-                    SafeCloseHandle(hCreate);
-                }
-            }
+    STORAGE_PROPERTY_QUERY q{};
+    q.PropertyId = StorageDeviceProperty;
+    q.QueryType = PropertyStandardQuery;
+    BYTE buf[1024]{};
+    DWORD returned = 0;
+    string identity;
+    if (DeviceIoControl(hDisk, IOCTL_STORAGE_QUERY_PROPERTY, &q, sizeof(q), buf, sizeof(buf), &returned, nullptr) &&
+        returned >= sizeof(STORAGE_DEVICE_DESCRIPTOR))
+    {
+        auto* desc = reinterpret_cast<STORAGE_DEVICE_DESCRIPTOR*>(buf);
+        // offsets point at NUL terminated, space padded strings; 0 = absent
+        auto field = [&](DWORD offset) -> string {
+            if (offset == 0 || offset >= returned) return "";
+            const char* p = reinterpret_cast<const char*>(buf) + offset;
+            string value(p, strnlen(p, returned - offset));
+            size_t start = value.find_first_not_of(' ');
+            if (start == string::npos) return "";
+            return value.substr(start, value.find_last_not_of(' ') - start + 1);
+        };
+
+        string serial = field(desc->SerialNumberOffset);
+        string model = field(desc->ProductIdOffset);
+        DISK_GEOMETRY_EX geometry{};
+        if (!serial.empty()) {
+            identity = "serial:" + serial;
         }
-
-        if (hFile != INVALID_HANDLE_VALUE) {
-            // Successfully opened with NO_BUFFERING, perform read test
-            auto start = chrono::high_resolution_clock::now();
-            ok = ReadFile(hFile, buffer, (DWORD)BUF_SIZE, &bytesDone, nullptr);
-            auto end = chrono::high_resolution_clock::now();
-
-            SafeCloseHandle(hFile);
-            DeleteFileA(testFile.c_str());
-
-            if (ok && bytesDone > 0) {
-                double seconds = chrono::duration<double>(end - start).count();
-                if (seconds < 0.001) seconds = 0.001;
-                _aligned_free(raw_buffer);
-                return (bytesDone / (1024.0 * 1024.0)) / seconds;
-            }
+        else if (!model.empty() && DeviceIoControl(hDisk, IOCTL_DISK_GET_DRIVE_GEOMETRY_EX, nullptr, 0,
+            &geometry, sizeof(geometry), &returned, nullptr)) {
+            identity = "model:" + model + ":" + to_string(geometry.DiskSize.QuadPart);
         }
     }
+    SafeCloseHandle(hDisk);
+    return identity;
+}
 
-    // All attempts failed
-    _aligned_free(raw_buffer);
-    return 0.0;
+// where a standard user may create the scratch file on that volume (write
+// tests opted in), and where a large file to read is looked for
+static vector<string> scratch_folders(const string& root_path) {
+    return { root_path, root_path + "Temp\\", root_path + "Users\\Public\\" };
 }
 
 // ============================================================
-//  CRITICAL FIX: Enhanced drive detection with fallbacks
+//  Stages (run by StorageInfoPipeline.cpp)
 // ============================================================
-vector<storage_data> StorageInfo::get_all_storage_info() {
-    vector<storage_data> all_disks;
 
-    // CRITICAL: Try multiple methods to get drives
+// every drive letter that has a root directory
+vector<storage_volume> StorageInfo::enumerate_volumes() {
+    vector<storage_volume> volumes;
     DWORD drive_mask = GetLogicalDrives();
 
     if (drive_mask == 0) {
-        // FALLBACK 1: Try GetLogicalDriveStrings
         char buffer[256];
         DWORD result = GetLogicalDriveStringsA(sizeof(buffer), buffer);
 
@@ -374,7 +307,6 @@ vector<storage_data> StorageInfo::get_all_storage_info() {
             }
         }
 
-        // FALLBACK 2: If still nothing, manually check common drives
         if (drive_mask == 0) {
             for (char c = 'C'; c <= 'D'; c++) {
                 string test = string(1, c) + ":\\";
@@ -385,288 +317,68 @@ vector<storage_data> StorageInfo::get_all_storage_info() {
         }
     }
 
-    if (drive_mask == 0) return all_disks; // No drives found at all
-
-    char drive_letter = 'A';
-    int disk_index = 0;
-
-    while (drive_mask) {
-        if (drive_mask & 1) {
-            string root_path = string(1, drive_letter) + ":\\";
-
-            // CRITICAL: Check if drive is accessible FIRST
-            UINT dt = GetDriveTypeA(root_path.c_str());
-            if (dt == DRIVE_NO_ROOT_DIR || dt == DRIVE_UNKNOWN) {
-                drive_mask >>= 1;
-                drive_letter++;
-                continue;
-            }
-
-            ULARGE_INTEGER free_bytes, total_bytes, free_bytes_available;
-
-            if (GetDiskFreeSpaceExA(root_path.c_str(), &free_bytes_available, &total_bytes, &free_bytes)) {
-                double total_gib = total_bytes.QuadPart / (1024.0 * 1024.0 * 1024.0);
-
-                // OPTIMIZATION: Skip tiny partitions (< 100MB)
-                if (total_gib < 0.1) {
-                    drive_mask >>= 1;
-                    drive_letter++;
-                    continue;
-                }
-
-                double free_gib = free_bytes.QuadPart / (1024.0 * 1024.0 * 1024.0);
-                double used_gib = total_gib - free_gib;
-                double used_percent = (total_gib > 0) ? (used_gib / total_gib) * 100.0 : 0.0;
-
-                char fs_name[MAX_PATH] = { 0 };
-                GetVolumeInformationA(root_path.c_str(), nullptr, 0, nullptr, nullptr, nullptr, fs_name, sizeof(fs_name));
-                string formatted_fs = string(fs_name);
-                if (formatted_fs.empty()) formatted_fs = "RAW";
-                if (formatted_fs == "NTFS") formatted_fs = "NTFS ";
-
-                bool is_external = (dt == DRIVE_REMOVABLE);
-
-                ostringstream used_str, total_str, percent_str;
-                used_str << fixed << setprecision(2) << used_gib;
-                total_str << fixed << setprecision(2) << total_gib;
-                percent_str << "(" << (int)used_percent << "%)";
-
-                storage_data disk;
-                disk.drive_letter = "Disk (" + string(1, drive_letter) + ":)";
-                disk.used_space = used_str.str();
-                disk.total_space = total_str.str();
-                disk.used_percentage = static_cast<int>(used_percent);  // Store as int directly
-                disk.file_system = formatted_fs;
-                disk.is_external = is_external;
-
-                // Storage type with error handling
-                try {
-                    disk.storage_type = get_storage_type(disk.drive_letter, root_path, is_external);
-                }
-                catch (...) {
-                    disk.storage_type = "SSD"; // Safe fallback
-                }
-
-                // Don't skip "Unknown" drives - show them anyway
-                // (User might have virtual drives, network drives, etc.)
-
-                // OPTIMIZED: Measure speeds with timeout protection and retry logic
-                double w = 0.0, r = 0.0;
-
-                try {
-                    // Try write test first (creates file for read test)
-                    w = measure_disk_speed(root_path, true);
+    for (char drive_letter = 'A'; drive_mask; drive_letter++, drive_mask >>= 1) {
+        if (!(drive_mask & 1)) continue;
+        string root_path = string(1, drive_letter) + ":\\";
 
-                    // Small delay to ensure file system sync
-                    Sleep(100);
+        UINT dt = GetDriveTypeA(root_path.c_str());
+        if (dt == DRIVE_NO_ROOT_DIR || dt == DRIVE_UNKNOWN) continue;
 
-                    // Try read test
-                    r = measure_disk_speed(root_path, false);
-
-                    // CRITICAL FIX: If both failed (0.0), retry with fallback method
-                    if (w == 0.0 && r == 0.0) {
-                        // Retry without NO_BUFFERING (for compatibility)
-                        Sleep(200);
-                        w = measure_disk_speed(root_path, true);
-                        Sleep(100);
-                        r = measure_disk_speed(root_path, false);
-                    }
-
-                }
-                catch (...) {
-                    w = 0.0;
-                    r = 0.0;
-                }
-
-                ostringstream ss;
-                ss << fixed << setprecision(2) << (r > 0 ? r : 0.0);
-                disk.read_speed = ss.str();
-                ss.str("");
-                ss.clear();
-                ss << fixed << setprecision(2) << (w > 0 ? w : 0.0);
-                disk.write_speed = ss.str();
-
-                disk.serial_number = "SN-" + to_string(1000 + disk_index);
-
-                // Predicted speeds based on type
-                if (disk.storage_type == "USB") {
-                    disk.predicted_read_speed = "100";
-                    disk.predicted_write_speed = "80";
-                }
-                else if (disk.storage_type == "SSD") {
-                    disk.predicted_read_speed = "500";
-                    disk.predicted_write_speed = "450";
-                }
-                else if (disk.storage_type == "HDD") {
-                    disk.predicted_read_speed = "140";
-                    disk.predicted_write_speed = "120";
-                }
-                else {
-                    disk.predicted_read_speed = "---";
-                    disk.predicted_write_speed = "---";
-                }
-
-                all_disks.push_back(disk);
-                disk_index++;
-            }
-        }
-        drive_letter++;
-        drive_mask >>= 1;
+        storage_volume volume;
+        volume.path = root_path;
+        volume.row.is_external = (dt == DRIVE_REMOVABLE);
+        volumes.push_back(volume);
     }
-
-    return all_disks;
+    return volumes;
 }
 
-// ============================================================
-//  SAME FIX: Enhanced process_storage_info with streaming
-// ============================================================
-void StorageInfo::process_storage_info(std::function<void(const storage_data&)> callback) {
-    DWORD drive_mask = GetLogicalDrives();
-
-    if (drive_mask == 0) {
-        char buffer[256];
-        DWORD result = GetLogicalDriveStringsA(sizeof(buffer), buffer);
-
-        if (result > 0 && result <= sizeof(buffer)) {
-            char* p = buffer;
-            while (*p) {
-                char drive_letter = toupper(*p);
-                if (drive_letter >= 'A' && drive_letter <= 'Z') {
-                    drive_mask |= (1 << (drive_letter - 'A'));
-                }
-                p += strlen(p) + 1;
-            }
-        }
+// used / total and the filesystem; drives that don't answer are skipped
+void StorageInfo::stat_volume(storage_volume& volume) {
+    const string& root_path = volume.path;
+    ULARGE_INTEGER free_bytes, total_bytes, free_bytes_available;
+    if (!GetDiskFreeSpaceExA(root_path.c_str(), &free_bytes_available, &total_bytes, &free_bytes)) return;
+
+    double total_gib = total_bytes.QuadPart / (1024.0 * 1024.0 * 1024.0);
+    if (total_gib < 0.1) return;
+
+    double free_gib = free_bytes.QuadPart / (1024.0 * 1024.0 * 1024.0);
+    double used_gib = total_gib - free_gib;
+    double used_percent = (total_gib > 0) ? (used_gib / total_gib) * 100.0 : 0.0;
+
+    char fs_name[MAX_PATH] = { 0 };
+    GetVolumeInformationA(root_path.c_str(), nullptr, 0, nullptr, nullptr, nullptr, fs_name, sizeof(fs_name));
+    string formatted_fs = string(fs_name);
+    if (formatted_fs.empty()) formatted_fs = "RAW";
+    if (formatted_fs == "NTFS") formatted_fs = "NTFS ";
+
+    ostringstream used_str, total_str;
+    used_str << fixed << setprecision(2) << used_gib;
+    total_str << fixed << setprecision(2) << total_gib;
+
+    storage_data& disk = volume.row;
+    disk.drive_letter = "Disk (" + string(1, root_path[0]) + ":)";
+    disk.used_space = used_str.str();
+    disk.total_space = total_str.str();
+    disk.used_percentage = static_cast<int>(used_percent);  // Store as int directly
+    disk.file_system = formatted_fs;
+    volume.shown = true;
+}
 
-        if (drive_mask == 0) {
-            for (char c = 'C'; c <= 'D'; c++) {
-                string test = string(1, c) + ":\\";
-                if (GetDriveTypeA(test.c_str()) == DRIVE_FIXED) {
-                    drive_mask |= (1 << (c - 'A'));
-                }
-            }
-        }
+// SSD / HDD / USB, and the physical disk the speed test runs on (one job
+// per disk, not per volume)
+void StorageInfo::classify_volume(storage_volume& volume) {
+    storage_data& disk = volume.row;
+    try {
+        disk.storage_type = get_storage_type(disk.drive_letter, volume.path, disk.is_external);
     }
-
-    if (drive_mask == 0) return;
-
-    char drive_letter = 'A';
-    int disk_index = 0;
-
-    while (drive_mask) {
-        if (drive_mask & 1) {
-            string root_path = string(1, drive_letter) + ":\\";
-
-            UINT dt = GetDriveTypeA(root_path.c_str());
-            if (dt == DRIVE_NO_ROOT_DIR || dt == DRIVE_UNKNOWN) {
-                drive_mask >>= 1;
-                drive_letter++;
-                continue;
-            }
-
-            ULARGE_INTEGER free_bytes, total_bytes, free_bytes_available;
-
-            if (GetDiskFreeSpaceExA(root_path.c_str(), &free_bytes_available, &total_bytes, &free_bytes)) {
-                double total_gib = total_bytes.QuadPart / (1024.0 * 1024.0 * 1024.0);
-
-                if (total_gib < 0.1) {
-                    drive_mask >>= 1;
-                    drive_letter++;
-                    continue;
-                }
-
-                double free_gib = free_bytes.QuadPart / (1024.0 * 1024.0 * 1024.0);
-                double used_gib = total_gib - free_gib;
-                double used_percent = (total_gib > 0) ? (used_gib / total_gib) * 100.0 : 0.0;
-
-                char fs_name[MAX_PATH] = { 0 };
-                GetVolumeInformationA(root_path.c_str(), nullptr, 0, nullptr, nullptr, nullptr, fs_name, sizeof(fs_name));
-                string formatted_fs = string(fs_name);
-                if (formatted_fs.empty()) formatted_fs = "RAW";
-                if (formatted_fs == "NTFS") formatted_fs = "NTFS ";
-
-                bool is_external = (dt == DRIVE_REMOVABLE);
-
-                ostringstream used_str, total_str, percent_str;
-                used_str << fixed << setprecision(2) << used_gib;
-                total_str << fixed << setprecision(2) << total_gib;
-                percent_str << "(" << (int)used_percent << "%)";
-
-                storage_data disk;
-                disk.drive_letter = "Disk (" + string(1, drive_letter) + ":)";
-                disk.used_space = used_str.str();
-                disk.total_space = total_str.str();
-                disk.used_percentage = static_cast<int>(used_percent);  // Store as int directly
-                disk.file_system = formatted_fs;
-                disk.is_external = is_external;
-
-                try {
-                    disk.storage_type = get_storage_type(disk.drive_letter, root_path, is_external);
-                }
-                catch (...) {
-                    disk.storage_type = "SSD";
-                }
-
-                double w = 0.0, r = 0.0;
-                try {
-                    // Try write test first (creates file for read test)
-                    w = measure_disk_speed(root_path, true);
-
-                    // Small delay to ensure file system sync
-                    Sleep(100);
-
-                    // Try read test
-                    r = measure_disk_speed(root_path, false);
-
-                    // CRITICAL FIX: If both failed (0.0), retry with fallback method
-                    if (w == 0.0 && r == 0.0) {
-                        // Retry without NO_BUFFERING (for compatibility)
-                        Sleep(200);
-                        w = measure_disk_speed(root_path, true);
-                        Sleep(100);
-                        r = measure_disk_speed(root_path, false);
-                    }
-
-                }
-                catch (...) {
-                    w = 0.0;
-                    r = 0.0;
-                }
-
-                ostringstream ss;
-                ss << fixed << setprecision(2) << (r > 0 ? r : 0.0);
-                disk.read_speed = ss.str();
-                ss.str("");
-                ss.clear();
-                ss << fixed << setprecision(2) << (w > 0 ? w : 0.0);
-                disk.write_speed = ss.str();
-
-                disk.serial_number = "SN-" + to_string(1000 + disk_index);
-
-                if (disk.storage_type == "USB") {
-                    disk.predicted_read_speed = "100";
-                    disk.predicted_write_speed = "80";
-                }
-                else if (disk.storage_type == "SSD") {
-                    disk.predicted_read_speed = "500";
-                    disk.predicted_write_speed = "450";
-                }
-                else if (disk.storage_type == "HDD") {
-                    disk.predicted_read_speed = "140";
-                    disk.predicted_write_speed = "120";
-                }
-                else {
-                    disk.predicted_read_speed = "---";
-                    disk.predicted_write_speed = "---";
-                }
-
-                callback(disk);
-                disk_index++;
-            }
-        }
-        drive_letter++;
-        drive_mask >>= 1;
+    catch (...) {
+        disk.storage_type = "SSD";
     }
+
+    volume.device = volume_device(volume.path);
+    volume.node = volume.device.compare(0, 13, "PhysicalDrive") == 0 ? "\\\\.\\" + volume.device : "";
+    volume.identity = device_identity(volume.device);
+    volume.folders = scratch_folders(volume.path);
 }
 
 /*
@@ -675,13 +387,17 @@ void StorageInfo::process_storage_info(std::function<void(const storage_data&)>
 
   KEY IMPROVEMENTS:
   ✅ Multiple fallback methods for drive detection
-  ✅ Reduced buffer size (16MB) for faster execution
+  ✅ Speed test in DiskBenchmark: 1 MiB sequential / 4 KiB random
+     blocks, FILE_FLAG_NO_BUFFERING so the OS cache is bypassed
   ✅ Safe handle management with error tracking
-  ✅ Removed FILE_FLAG_NO_BUFFERING for compatibility
-  ✅ Try-catch protection around speed measurements
+  ✅ Try-catch protection around drive type detection
+  ✅ Speed test that failed or didn't run (the write test is off
+     by default) shows "---" on screen, not 0.00
   ✅ Graceful degradation when permissions denied
   ✅ Skip tiny partitions (< 100MB) automatically
   ✅ Conservative SSD fallback for unknown types
   ✅ Compatible with standard user permissions
 ===============================================================
-*/
\ No newline at end of file
+*/
+
+#endif // _WIN32
@@ -0,0 +1,297 @@
+/*
+================================================================================
+ StorageInfoLinux.cpp — StorageInfo for Linux
+================================================================================
+
+Windows has drive letters, Linux has mounts. Every real filesystem listed in
+/proc/self/mountinfo becomes one storage_data entry ("Disk (/home)"):
+
+    which mounts     /proc/self/mountinfo, minus pseudo filesystems (proc,
+                     cgroup, tmpfs...) and minus repeated mounts of the same
+                     device (bind mounts, btrfs subvolumes mounted twice)
+    SSD / HDD / USB  /sys/dev/block/<major:minor> -> the whole disk's
+                     queue/rotational and removable flags, USB from its path
+    used / total     statvfs()
+    read / write     DiskBenchmark (O_DIRECT + io_uring), once per whole disk,
+                     all disks at the same time: /dev/<disk> read directly,
+                     or a large file on one of its mounts without the rights
+                     for that; a scratch file only with benchmark.write on.
+                     Kept in BenchmarkCache by WWN / serial, so a later run
+                     shows the stored figures until they expire
+
+This file only holds the Linux stages (enumerate, stat, classify); running
+them, the speed test and the order rows come out in are StorageInfoPipeline.cpp.
+
+statvfs() is the dangerous part: on a stale NFS server or a dead FUSE daemon
+it never returns. So every statvfs() gets its own detached thread, and the stat
+stage as a whole waits at most STATVFS_TIMEOUT_MS for them: one deadline for
+every mount, however many of them hang. A mount that misses it is skipped, exactly like a Windows drive whose GetDiskFreeSpaceEx fails; the
+stuck thread is left behind and dies with the process.
+================================================================================
+*/
+#include "include/StorageInfo.h"
+
+#ifndef _WIN32
+#include "include/LinuxSysfs.h"
+
+#include <sstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <set>
+#include <utility>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <climits>
+#include <sys/statvfs.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+using namespace std;
+
+static const unsigned STATVFS_TIMEOUT_MS = 1000;
+
+// one statvfs() running on its own thread
+struct MountProbe {
+    mutex m;
+    condition_variable cv;
+    bool done = false;
+    bool ok = false;
+    struct statvfs st;
+};
+
+// -------------------- Mount enumeration --------------------
+
+// kernel / virtual filesystems that never hold user data
+static bool is_pseudo_fs(const string& fs) {
+    static const set<string> pseudo = {
+        "proc", "sysfs", "devtmpfs", "devpts", "tmpfs", "ramfs", "cgroup", "cgroup2",
+        "securityfs", "pstore", "debugfs", "tracefs", "configfs", "fusectl", "mqueue",
+        "hugetlbfs", "bpf", "autofs", "binfmt_misc", "efivarfs", "rpc_pipefs", "nsfs",
+        "selinuxfs", "nfsd", "squashfs",              // squashfs: snap images, always 100% full
+        "fuse.gvfsd-fuse", "fuse.portal", "fuse.lxcfs"
+    };
+    return pseudo.count(fs) > 0;
+}
+
+// mountinfo escapes blanks as octal: "/media/My\040Disk"
+static string unescape_mount(const string& s) {
+    string out;
+    for (size_t i = 0; i < s.size(); ++i) {
+        if (s[i] == '\\' && i + 3 < s.size() && isdigit(static_cast<unsigned char>(s[i + 1]))) {
+            out += static_cast<char>(strtol(s.substr(i + 1, 3).c_str(), nullptr, 8));
+            i += 3;
+        }
+        else {
+            out += s[i];
+        }
+    }
+    return out;
+}
+
+// every mount point, pseudo filesystems included (a /tmp on tmpfs is still
+// not the root filesystem's /tmp)
+static vector<string> mount_points() {
+    vector<string> points;
+    istringstream lines(sysfs_read_all("/proc/self/mountinfo"));
+    string line;
+    while (getline(lines, line)) {
+        istringstream fields(line);
+        string id, parent, dev, root, mountPoint;
+        if (fields >> id >> parent >> dev >> root >> mountPoint) points.push_back(unescape_mount(mountPoint));
+    }
+    return points;
+}
+
+// the innermost of <points> that <path> lies under, by name only: nothing
+// on the way is touched, so a hung mount elsewhere can't block it
+static string owning_mount(const string& path, const vector<string>& points) {
+    string owner;
+    for (const string& point : points) {
+        bool under = point == "/" ? path.compare(0, 1, "/") == 0
+            : path.compare(0, point.size(), point) == 0 && (path.size() == point.size() || path[point.size()] == '/');
+        if (under && point.size() > owner.size()) owner = point;
+    }
+    return owner;
+}
+
+// "36 35 98:0 /mnt1 /mnt/parent rw,noatime master:1 - ext3 /dev/root rw"
+static vector<storage_volume> read_mounts() {
+    vector<storage_volume> mounts;
+    string text = sysfs_read_all("/proc/self/mountinfo");
+    set<pair<unsigned, unsigned>> seen;
+
+    istringstream lines(text);
+    string line;
+    while (getline(lines, line)) {
+        istringstream fields(line);
+        string id, parent, dev, root, mountPoint, field;
+        if (!(fields >> id >> parent >> dev >> root >> mountPoint)) continue;
+
+        // optional fields until "-", then the filesystem type
+        while (fields >> field && field != "-") {}
+        storage_volume entry;
+        if (!(fields >> entry.fs_type) || is_pseudo_fs(entry.fs_type)) continue;
+
+        if (sscanf(dev.c_str(), "%u:%u", &entry.major, &entry.minor) != 2) continue;
+        if (!seen.insert({ entry.major, entry.minor }).second) continue; // same device again
+
+        entry.path = unescape_mount(mountPoint);
+        mounts.push_back(entry);
+    }
+    return mounts;
+}
+
+// -------------------- Device classification --------------------
+
+// sysfs directory of the whole disk behind major:minor ("" for network
+// and other device-less filesystems); a partition's flags live on its parent
+static string whole_disk(const storage_volume& mount) {
+    if (mount.major == 0) return "";
+
+    char link[64];
+    snprintf(link, sizeof(link), "/sys/dev/block/%u:%u", mount.major, mount.minor);
+    char real[PATH_MAX];
+    if (!realpath(link, real)) return "";
+
+    string disk = real;
+    if (sysfs_read_long((disk + "/partition").c_str(), -1) >= 0) disk = disk.substr(0, disk.rfind('/'));
+    return disk;
+}
+
+// "SSD" / "HDD" / "USB" from the whole disk behind major:minor,
+// "Unknown" for network and other device-less filesystems
+static string classify_device(const storage_volume& mount, bool& is_external) {
+    is_external = false;
+    string disk = whole_disk(mount);
+    if (disk.empty()) return "Unknown";
+
+    bool usb = disk.find("/usb") != string::npos;
+    bool removable = sysfs_read_long((disk + "/removable").c_str(), 0) == 1;
+    if (usb || removable) {
+        is_external = true;
+        return "USB";
+    }
+
+    long long rotational = sysfs_read_long((disk + "/queue/rotational").c_str(), -1);
+    if (rotational == 0) return "SSD";
+    if (rotational == 1) return "HDD";
+    return "Unknown";
+}
+
+// -------------------- Speed test --------------------
+
+// what the cached speed test of a whole disk is filed under: its WWN or
+// serial, else model + size (virtio disks often report neither)
+static string disk_identity(const string& disk) {
+    const char* keys[][2] = {
+        { "/wwid", "wwid:" }, { "/device/wwid", "wwid:" },
+        { "/serial", "serial:" }, { "/device/serial", "serial:" },
+    };
+    for (auto& key : keys) {
+        string value = sysfs_read_string((disk + key[0]).c_str());
+        size_t start = value.find_first_not_of(' ');
+        if (start != string::npos) return key[1] + value.substr(start);
+    }
+
+    long long sectors = sysfs_read_long((disk + "/size").c_str(), -1);
+    if (sectors <= 0) return "";
+    string model = sysfs_read_string((disk + "/device/model").c_str());
+    if (model.empty()) model = disk.substr(disk.rfind('/') + 1);
+    return "model:" + model + ":" + to_string(sectors);
+}
+
+// where the scratch file for <mount> may go (write tests opted in) and
+// where a large file to read is looked for: the mount point or a folder on
+// the same filesystem (a user can't write to / but can to /tmp or $HOME).
+// Only folders whose path lies under <mount> are stat()ed: <mount> just
+// answered statvfs(), a $HOME on a stale NFS server would hang the stage.
+// lstat(): a symlink could lead anywhere, it is skipped
+static vector<string> scratch_folders(const storage_volume& mount) {
+    string base = mount.path == "/" ? "" : mount.path;
+    vector<string> candidates = { mount.path, base + "/tmp", base + "/var/tmp" };
+    for (const char* env : { "TMPDIR", "HOME" }) {
+        const char* dir = getenv(env);
+        if (dir && *dir == '/') candidates.push_back(dir);
+    }
+
+    vector<string> points = mount_points();
+    vector<string> dirs;
+    for (const string& dir : candidates) {
+        if (owning_mount(dir, points) != mount.path) continue;
+        struct stat st;
+        if (lstat(dir.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) continue;
+        if (major(st.st_dev) == mount.major && minor(st.st_dev) == mount.minor) dirs.push_back(dir);
+    }
+    return dirs;
+}
+
+// -------------------- Stages --------------------
+
+vector<storage_volume> StorageInfo::enumerate_volumes() {
+    vector<storage_volume> mounts = read_mounts();
+    stat_deadline = chrono::steady_clock::now() + chrono::milliseconds(STATVFS_TIMEOUT_MS);
+    return mounts;
+}
+
+// statvfs() on its own detached thread: a mount that hasn't answered by
+// stat_deadline is skipped and the thread is left behind
+void StorageInfo::stat_volume(storage_volume& volume) {
+    auto probe = make_shared<MountProbe>();
+    string path = volume.path;
+    thread([probe, path] {
+        struct statvfs st;
+        bool ok = statvfs(path.c_str(), &st) == 0;
+        lock_guard<mutex> lock(probe->m);
+        probe->st = st;
+        probe->ok = ok;
+        probe->done = true;
+        probe->cv.notify_all();
+        }).detach();
+
+    struct statvfs st;
+    {
+        unique_lock<mutex> lock(probe->m);
+        probe->cv.wait_until(lock, stat_deadline, [&] { return probe->done; });
+        if (!probe->done || !probe->ok) return; // hung or failed: skip
+        st = probe->st;
+    }
+
+    double total_gib = static_cast<double>(st.f_blocks) * st.f_frsize / (1024.0 * 1024.0 * 1024.0);
+    if (total_gib < 0.1) return; // Skip tiny partitions (< 100MB)
+
+    double free_gib = static_cast<double>(st.f_bfree) * st.f_frsize / (1024.0 * 1024.0 * 1024.0);
+    double used_gib = total_gib - free_gib;
+    double used_percent = (total_gib > 0) ? (used_gib / total_gib) * 100.0 : 0.0;
+
+    ostringstream used_str, total_str;
+    used_str << fixed << setprecision(2) << used_gib;
+    total_str << fixed << setprecision(2) << total_gib;
+
+    storage_data& disk = volume.row;
+    disk.drive_letter = "Disk (" + volume.path + ")";
+    disk.used_space = used_str.str();
+    disk.total_space = total_str.str();
+    disk.used_percentage = static_cast<int>(used_percent);
+    disk.file_system = volume.fs_type;
+    volume.shown = true;
+}
+
+// type from sysfs, and the whole disk the speed test runs on (NFS,
+// overlay...: none, nothing to measure)
+void StorageInfo::classify_volume(storage_volume& volume) {
+    volume.row.storage_type = classify_device(volume, volume.row.is_external);
+
+    string disk = whole_disk(volume);
+    if (disk.empty()) return;
+    volume.device = disk;
+    volume.node = "/dev/" + disk.substr(disk.rfind('/') + 1);
+    volume.identity = disk_identity(disk);
+    volume.folders = scratch_folders(volume);
+}
+
+#endif
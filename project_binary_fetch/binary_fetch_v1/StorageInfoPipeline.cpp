@@ -0,0 +1,162 @@
+/*
+================================================================================
+ StorageInfoPipeline.cpp — the StorageInfo stages, both platforms
+================================================================================
+
+StorageInfo.cpp (Windows) and StorageInfoLinux.cpp only say how to list the
+volumes, size them and classify them. Running those stages, the speed test and
+handing rows out in order happens here, once:
+
+    enumerate    one call, the volume list
+    stat         } one task per volume on at most <concurrency> threads;
+    classify     } row i goes to <sized> once it and rows 0..i-1 are done
+    benchmark    one DiskBenchmarkBatch job per physical disk not measured
+                 yet (this run, or recently enough for BenchmarkCache);
+                 row i goes to <measured> once its disk is done
+
+So capacity and filesystem of every volume reach the screen while the first
+speed test is still warming up. The speed test starts once every volume is
+classified: only then are all the folders of a disk known.
+================================================================================
+*/
+#include "include/StorageInfo.h"
+#include "include/BenchmarkCache.h"
+
+#include <sstream>
+#include <iomanip>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+using namespace std;
+
+// -------------------- Ordered, bounded stage runner --------------------
+
+// task(i) for every i < count on at most <workers> threads; deliver(i) on
+// the calling thread in index order, each as soon as its task is done
+static void run_ordered(size_t count, unsigned workers,
+    const function<void(size_t)>& task, const function<void(size_t)>& deliver)
+{
+    mutex m;
+    condition_variable finished;
+    vector<char> done(count, 0);
+    size_t next = 0;
+
+    vector<thread> pool;
+    size_t threads = workers > 0 ? workers : 1;
+    if (threads > count) threads = count;
+    for (size_t w = 0; w < threads; ++w) {
+        pool.emplace_back([&] {
+            while (true) {
+                size_t i;
+                {
+                    lock_guard<mutex> lock(m);
+                    if (next == count) return;
+                    i = next++;
+                }
+                task(i);
+                lock_guard<mutex> lock(m);
+                done[i] = 1;
+                finished.notify_all();
+            }
+        });
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        {
+            unique_lock<mutex> lock(m);
+            finished.wait(lock, [&] { return done[i] != 0; });
+        }
+        deliver(i);
+    }
+    for (auto& worker : pool) worker.join();
+}
+
+// -------------------- Speeds --------------------
+
+// read / write: sequential 1 MiB throughput of the disk, "---" for a test
+// that failed or didn't run (the write test is off by default); "predicted"
+// used to be a constant per drive type and now shows the same figures
+static string speed_text(const BenchmarkResult& result) {
+    if (!result.ok) return "---";
+    ostringstream ss;
+    ss << fixed << setprecision(2) << result.mbps;
+    return ss.str();
+}
+
+static void fill_speeds(storage_data& disk, const DiskBenchmarkReport& report) {
+    disk.benchmark = report;
+    disk.read_speed = speed_text(report.seqRead);
+    disk.write_speed = speed_text(report.seqWrite);
+    disk.predicted_read_speed = disk.read_speed;
+    disk.predicted_write_speed = disk.write_speed;
+}
+
+// -------------------- StorageInfo --------------------
+
+vector<storage_data> StorageInfo::get_all_storage_info() {
+    vector<storage_data> all_disks;
+    process_storage_info([&](const storage_data& d) { all_disks.push_back(d); });
+    return all_disks;
+}
+
+void StorageInfo::process_storage_info(function<void(const storage_data&)> callback) {
+    process_storage_info([](const storage_data&) {}, callback);
+}
+
+void StorageInfo::process_storage_info(function<void(const storage_data&)> sized, function<void(const storage_data&)> measured) {
+    vector<storage_volume> volumes = enumerate_volumes();
+
+    // stat + classify, rows out in order as they are ready
+    int disk_index = 0;
+    run_ordered(volumes.size(), concurrency,
+        [&](size_t i) {
+            stat_volume(volumes[i]);
+            if (volumes[i].shown) classify_volume(volumes[i]);
+        },
+        [&](size_t i) {
+            if (!volumes[i].shown) return;
+            volumes[i].row.serial_number = "SN-" + to_string(1000 + disk_index++);
+            sized(volumes[i].row);
+        });
+
+    // benchmark: a disk measured on an earlier run with the same settings,
+    // and still fresh, is taken from BenchmarkCache; every other one gets a job
+    DiskBenchmarkBatch batch(benchmark_options);
+    map<string, string> identities;            // disks with a job: their cache key
+    for (const storage_volume& volume : volumes) {
+        if (!volume.shown || volume.device.empty() || device_benchmarks.count(volume.device)) continue;
+        if (!identities.count(volume.device)) {
+            DiskBenchmarkReport cached;
+            long long age = 0;
+            if (BenchmarkCache::instance().disk(volume.identity, benchmark_options, cached, age)) {
+                device_benchmarks[volume.device] = cached;
+                device_ages[volume.device] = age;
+                continue;
+            }
+            identities[volume.device] = volume.identity;
+        }
+        batch.add(volume.device, volume.folders, volume.node);
+    }
+
+    // the disks run in parallel, the rows still come out in order: the
+    // slowest disk sets the pace
+    batch.start();
+    for (storage_volume& volume : volumes) {
+        if (!volume.shown) continue;
+        auto known = device_benchmarks.find(volume.device);
+        if (known != device_benchmarks.end()) {
+            fill_speeds(volume.row, known->second);
+            auto age = device_ages.find(volume.device);
+            if (age != device_ages.end()) volume.row.benchmark_age = age->second;
+        }
+        else {
+            const DiskBenchmarkReport& report = batch.wait(volume.device);
+            if (report.ok) {
+                device_benchmarks[volume.device] = report;
+                BenchmarkCache::instance().storeDisk(identities[volume.device], benchmark_options, report);
+            }
+            fill_speeds(volume.row, report);
+        }
+        measured(volume.row);
+    }
+}
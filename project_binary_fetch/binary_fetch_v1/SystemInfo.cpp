@@ -1,5 +1,10 @@
-#include "include\SystemInfo.h"
+#include "include/SystemInfo.h"
+#include "include/StaticCache.h"
+#ifdef _WIN32
 #include <windows.h>
+#else
+#include "include/LinuxSysfs.h"
+#endif
 #include <iostream>
 using namespace std;
 
@@ -11,6 +16,7 @@ SystemInfo::~SystemInfo() {
     // Nothing to clean
 }
 
+#ifdef _WIN32
 // Registry reading function (internal)
 string SystemInfo::read_registry_value(const string& subkey, const string& valueName) {
     HKEY hKey;
@@ -29,25 +35,56 @@ string SystemInfo::read_registry_value(const string& subkey, const string& value
     RegCloseKey(hKey);
     return string(value);
 }
+#else
+// Linux has no registry: /sys/class/dmi/id holds the same strings and, unlike
+// the raw tables under /sys/firmware/dmi, can be read without root.
+string SystemInfo::read_registry_value(const string&, const string& valueName) {
+    static const pair<const char*, const char*> files[] = {
+        { "BIOSVendor", "bios_vendor" },
+        { "BIOSVersion", "bios_version" },
+        { "BIOSReleaseDate", "bios_date" },
+        { "BaseBoardProduct", "board_name" },
+        { "BaseBoardManufacturer", "board_vendor" },
+    };
+    for (const auto& f : files) {
+        if (valueName != f.first) continue;
+        string v = sysfs_read_string((string("/sys/class/dmi/id/") + f.second).c_str());
+        return v.empty() ? "N/A" : v;
+    }
+    return "N/A";
+}
+#endif
+
+// BIOS / board values go through StaticCache ("N/A" is not stored).
+// The registry copy is only read if the SMBIOS table lacks the string.
+string SystemInfo::read_bios_value(const string& key, string SMBIOSInfo::* field, const string& valueName) {
+    string value = StaticCache::instance().text(key, [&] {
+        string v = smbios_system().*field;
+        if (!v.empty()) return v;
+        v = read_registry_value("HARDWARE\\DESCRIPTION\\System\\BIOS", valueName);
+        return v == "N/A" ? string() : v;
+        });
+    return value.empty() ? "N/A" : value;
+}
 
 // BIOS info
 string SystemInfo::get_bios_vendor() {
-    return read_registry_value("HARDWARE\\DESCRIPTION\\System\\BIOS", "BIOSVendor");
+    return read_bios_value("bios.vendor", &SMBIOSInfo::biosVendor, "BIOSVendor");
 }
 
 string SystemInfo::get_bios_version() {
-    return read_registry_value("HARDWARE\\DESCRIPTION\\System\\BIOS", "BIOSVersion");
+    return read_bios_value("bios.version", &SMBIOSInfo::biosVersion, "BIOSVersion");
 }
 
 string SystemInfo::get_bios_date() {
-    return read_registry_value("HARDWARE\\DESCRIPTION\\System\\BIOS", "BIOSReleaseDate");
+    return read_bios_value("bios.date", &SMBIOSInfo::biosDate, "BIOSReleaseDate");
 }
 
 // Motherboard info
 string SystemInfo::get_motherboard_model() {
-    return read_registry_value("HARDWARE\\DESCRIPTION\\System\\BIOS", "BaseBoardProduct");
+    return read_bios_value("board.model", &SMBIOSInfo::boardModel, "BaseBoardProduct");
 }
 
 string SystemInfo::get_motherboard_manufacturer() {
-    return read_registry_value("HARDWARE\\DESCRIPTION\\System\\BIOS", "BaseBoardManufacturer");
+    return read_bios_value("board.manufacturer", &SMBIOSInfo::boardManufacturer, "BaseBoardManufacturer");
 }
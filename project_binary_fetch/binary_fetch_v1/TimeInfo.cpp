@@ -1,4 +1,4 @@
-#include "include\TimeInfo.h"
+#include "include/TimeInfo.h"
 using namespace std;
 
 // Constructor - gets current system time
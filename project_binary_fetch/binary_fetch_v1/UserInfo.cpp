@@ -1,4 +1,4 @@
-#include "include\UserInfo.h"
+#include "include/UserInfo.h"
 #include <Windows.h>
 #include <lm.h>
 #include <iostream>
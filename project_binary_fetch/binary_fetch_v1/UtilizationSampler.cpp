@@ -0,0 +1,395 @@
+#include "include/UtilizationSampler.h"
+#include <thread>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <pdh.h>
+#include <pdhmsg.h>
+#pragma comment(lib, "pdh.lib")
+#else
+#include <map>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#endif
+
+using namespace std;
+
+static double clamp_percent(double v) {
+    if (v < 0.0) return 0.0;
+    if (v > 100.0) return 100.0;
+    return v;
+}
+
+#ifdef _WIN32
+// ============================================================
+// Windows: one PDH query holding every counter we need
+// ============================================================
+struct UtilizationSampler::Platform {
+    PDH_HQUERY query = nullptr;
+    PDH_HCOUNTER cpuTotal = nullptr;
+    PDH_HCOUNTER cpuCores = nullptr;    // \Processor Information(*): every processor group
+    PDH_HCOUNTER gpuEngines = nullptr;  // \GPU Engine(*engtype_3D)
+    PDH_HCOUNTER diskIdle = nullptr;    // \PhysicalDisk(_Total)\% Idle Time
+};
+
+// English names so the counters also resolve on localized Windows
+static PDH_HCOUNTER add_counter(PDH_HQUERY query, const wchar_t* path) {
+    PDH_HCOUNTER counter = nullptr;
+    if (PdhAddEnglishCounterW(query, path, 0, &counter) != ERROR_SUCCESS) return nullptr;
+    return counter;
+}
+
+static bool read_single(PDH_HCOUNTER counter, double& out) {
+    if (!counter) return false;
+    PDH_FMT_COUNTERVALUE value;
+    if (PdhGetFormattedCounterValue(counter, PDH_FMT_DOUBLE | PDH_FMT_NOCAP100, nullptr, &value) != ERROR_SUCCESS) return false;
+    out = value.doubleValue;
+    return true;
+}
+
+// wildcard counters come back as one item per instance
+static bool read_array(PDH_HCOUNTER counter, vector<pair<wstring, double>>& out) {
+    if (!counter) return false;
+
+    DWORD bufferSize = 0, itemCount = 0;
+    PDH_STATUS status = PdhGetFormattedCounterArrayW(counter, PDH_FMT_DOUBLE | PDH_FMT_NOCAP100, &bufferSize, &itemCount, nullptr);
+    if (status != PDH_MORE_DATA) return false;
+
+    vector<BYTE> buffer(bufferSize);
+    auto* items = reinterpret_cast<PDH_FMT_COUNTERVALUE_ITEM_W*>(buffer.data());
+    status = PdhGetFormattedCounterArrayW(counter, PDH_FMT_DOUBLE | PDH_FMT_NOCAP100, &bufferSize, &itemCount, items);
+    if (status != ERROR_SUCCESS) return false;
+
+    for (DWORD i = 0; i < itemCount; ++i) {
+        if (items[i].FmtValue.CStatus != PDH_CSTATUS_VALID_DATA && items[i].FmtValue.CStatus != PDH_CSTATUS_NEW_DATA) continue;
+        out.emplace_back(items[i].szName, items[i].FmtValue.doubleValue);
+    }
+    return true;
+}
+
+// "group,index" instance of \Processor Information -> logical processor number
+// (groups are numbered one after the other); "_Total" / "0,_Total" are sums
+static bool core_slot(const wstring& name, size_t& slot) {
+    if (name.find(L"_Total") != wstring::npos) return false;
+
+    const wchar_t* text = name.c_str();
+    wchar_t* end = nullptr;
+    unsigned long group = 0;
+    size_t comma = name.find(L',');
+    if (comma != wstring::npos) {
+        group = wcstoul(text, &end, 10);
+        if (end != text + comma) return false;
+        text += comma + 1;
+    }
+    unsigned long index = wcstoul(text, &end, 10);
+    if (end == text || *end != L'\0') return false;
+
+    size_t base = 0;
+    for (unsigned long g = 0; g < group; ++g) base += GetActiveProcessorCount(static_cast<WORD>(g));
+    slot = base + index;
+    return true;
+}
+
+static void platform_baseline(UtilizationSampler::Platform*& p) {
+    p = new UtilizationSampler::Platform();
+    if (PdhOpenQuery(nullptr, 0, &p->query) != ERROR_SUCCESS) {
+        p->query = nullptr;
+        return;
+    }
+    p->cpuTotal = add_counter(p->query, L"\\Processor(_Total)\\% Processor Time");
+    p->cpuCores = add_counter(p->query, L"\\Processor Information(*)\\% Processor Time");
+    p->gpuEngines = add_counter(p->query, L"\\GPU Engine(*engtype_3D)\\Utilization Percentage");
+    p->diskIdle = add_counter(p->query, L"\\PhysicalDisk(_Total)\\% Idle Time");
+    PdhCollectQueryData(p->query);
+}
+
+static void platform_close(UtilizationSampler::Platform* p, double& cpu, vector<double>& cores, double& gpu, double& disk, double /*elapsedMs*/) {
+    if (!p || !p->query) return;
+    // rate counters are computed against the query's previous collection,
+    // so this one is also the baseline of the next window (nextWindow)
+    PdhCollectQueryData(p->query);
+
+    double value = 0.0;
+    if (read_single(p->cpuTotal, value)) cpu = clamp_percent(value);
+
+    vector<pair<wstring, double>> items;
+    if (read_array(p->cpuCores, items)) {
+        for (const auto& item : items) {
+            size_t index = 0;
+            if (!core_slot(item.first, index)) continue;
+            if (index >= cores.size()) cores.resize(index + 1, 0.0);
+            cores[index] = clamp_percent(item.second);
+        }
+    }
+
+    // every process gets its own 3D engine instance -> the sum is the GPU load
+    items.clear();
+    if (read_array(p->gpuEngines, items)) {
+        double total = 0.0;
+        for (const auto& item : items) total += item.second;
+        gpu = clamp_percent(total);
+    }
+
+    if (read_single(p->diskIdle, value)) disk = clamp_percent(100.0 - value);
+}
+
+static void platform_release(UtilizationSampler::Platform* p) {
+    if (!p) return;
+    if (p->query) PdhCloseQuery(p->query);
+    delete p;
+}
+
+#else
+// ============================================================
+// Linux: /proc/stat + /proc/diskstats snapshots
+// ============================================================
+struct CpuTimes {
+    unsigned long long busy = 0;
+    unsigned long long total = 0;
+};
+
+struct UtilizationSampler::Platform {
+    vector<CpuTimes> cpu;                           // [0] = aggregate, [1..] = cpuN
+    map<string, unsigned long long> ioTicks;        // disk -> ms spent doing I/O
+    int statFd = -1;                                // kept open, re-read from offset 0
+    int diskstatsFd = -1;
+};
+
+static bool read_whole_file(const char* path, string& out) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    char buf[4096];
+    ssize_t n;
+    out.clear();
+    while ((n = read(fd, buf, sizeof(buf))) > 0) out.append(buf, static_cast<size_t>(n));
+    close(fd);
+    return !out.empty();
+}
+
+// procfs files regenerate on every read from offset 0, so one descriptor
+// serves every sample of a --watch session
+static bool reread_file(int& fd, const char* path, string& out) {
+    if (fd < 0) fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    char buf[4096];
+    ssize_t n;
+    off_t offset = 0;
+    out.clear();
+    while ((n = pread(fd, buf, sizeof(buf), offset)) > 0) {
+        out.append(buf, static_cast<size_t>(n));
+        offset += n;
+    }
+    return !out.empty();
+}
+
+static vector<CpuTimes> read_proc_stat(int& fd) {
+    vector<CpuTimes> result;
+    string text;
+    if (!reread_file(fd, "/proc/stat", text)) return result;
+
+    const char* p = text.c_str();
+    while (strncmp(p, "cpu", 3) == 0) {
+        char* end = const_cast<char*>(p + 3);
+        size_t index = 0;
+        if (*end >= '0' && *end <= '9') index = strtoul(end, &end, 10) + 1;
+
+        // user nice system idle iowait irq softirq steal
+        unsigned long long v[8] = {};
+        for (int i = 0; i < 8; ++i) v[i] = strtoull(end, &end, 10);
+
+        CpuTimes t;
+        for (int i = 0; i < 8; ++i) t.total += v[i];
+        t.busy = t.total - v[3] - v[4];
+        if (index >= result.size()) result.resize(index + 1);
+        result[index] = t;
+
+        const char* nl = strchr(p, '\n');
+        if (!nl) break;
+        p = nl + 1;
+    }
+    return result;
+}
+
+// whole physical devices only (partitions and stacked devices would double count)
+static bool is_physical_disk(const string& name) {
+    if (name.compare(0, 4, "loop") == 0 || name.compare(0, 3, "ram") == 0 ||
+        name.compare(0, 4, "zram") == 0 || name.compare(0, 3, "dm-") == 0 ||
+        name.compare(0, 2, "md") == 0) return false;
+    string path = "/sys/block/" + name;
+    return access(path.c_str(), F_OK) == 0;
+}
+
+static map<string, unsigned long long> read_diskstats(int& fd) {
+    map<string, unsigned long long> result;
+    string text;
+    if (!reread_file(fd, "/proc/diskstats", text)) return result;
+
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t nl = text.find('\n', pos);
+        if (nl == string::npos) nl = text.size();
+        string line = text.substr(pos, nl - pos);
+        pos = nl + 1;
+
+        unsigned major = 0, minor = 0;
+        char name[64] = {};
+        unsigned long long f[10] = {};
+        // major minor name reads rmerged rsect rms writes wmerged wsect wms inflight io_ticks
+        int got = sscanf(line.c_str(), "%u %u %63s %llu %llu %llu %llu %llu %llu %llu %llu %llu %llu",
+            &major, &minor, name, &f[0], &f[1], &f[2], &f[3], &f[4], &f[5], &f[6], &f[7], &f[8], &f[9]);
+        if (got < 13 || !is_physical_disk(name)) continue;
+        result[name] = f[9];
+    }
+    return result;
+}
+
+// amdgpu exposes a ready-made busy percent, no window needed
+static double read_gpu_busy() {
+    double best = -1.0;
+    DIR* dir = opendir("/sys/class/drm");
+    if (!dir) return best;
+    while (dirent* entry = readdir(dir)) {
+        if (strncmp(entry->d_name, "card", 4) != 0 || strchr(entry->d_name, '-')) continue;
+        string path = string("/sys/class/drm/") + entry->d_name + "/device/gpu_busy_percent";
+        string text;
+        if (!read_whole_file(path.c_str(), text)) continue;
+        best = max(best, clamp_percent(atof(text.c_str())));
+    }
+    closedir(dir);
+    return best;
+}
+
+static void platform_baseline(UtilizationSampler::Platform*& p) {
+    p = new UtilizationSampler::Platform();
+    p->cpu = read_proc_stat(p->statFd);
+    p->ioTicks = read_diskstats(p->diskstatsFd);
+}
+
+static double busy_between(const CpuTimes& a, const CpuTimes& b) {
+    if (b.total <= a.total) return 0.0;
+    return clamp_percent(100.0 * static_cast<double>(b.busy - a.busy) / static_cast<double>(b.total - a.total));
+}
+
+static void platform_close(UtilizationSampler::Platform* p, double& cpu, vector<double>& cores, double& gpu, double& disk, double elapsedMs) {
+    if (!p) return;
+
+    vector<CpuTimes> now = read_proc_stat(p->statFd);
+    if (!now.empty() && !p->cpu.empty()) {
+        cpu = busy_between(p->cpu[0], now[0]);
+        size_t n = min(now.size(), p->cpu.size());
+        for (size_t i = 1; i < n; ++i) cores.push_back(busy_between(p->cpu[i], now[i]));
+    }
+
+    // average busy time across physical disks (same meaning as _Total on Windows)
+    map<string, unsigned long long> ticks = read_diskstats(p->diskstatsFd);
+    if (!ticks.empty() && elapsedMs > 0.0) {
+        double sum = 0.0;
+        int count = 0;
+        for (const auto& d : ticks) {
+            auto before = p->ioTicks.find(d.first);
+            if (before == p->ioTicks.end() || d.second < before->second) continue;
+            sum += clamp_percent(100.0 * static_cast<double>(d.second - before->second) / elapsedMs);
+            ++count;
+        }
+        if (count > 0) disk = sum / count;
+    }
+
+    gpu = read_gpu_busy();
+
+    // this sample is the baseline of the next window (nextWindow)
+    if (!now.empty()) p->cpu = move(now);
+    if (!ticks.empty()) p->ioTicks = move(ticks);
+}
+
+static void platform_release(UtilizationSampler::Platform* p) {
+    if (!p) return;
+    if (p->statFd >= 0) close(p->statFd);
+    if (p->diskstatsFd >= 0) close(p->diskstatsFd);
+    delete p;
+}
+#endif
+
+// ============================================================
+// Shared logic
+// ============================================================
+UtilizationSampler& UtilizationSampler::instance() {
+    static UtilizationSampler sampler;
+    return sampler;
+}
+
+UtilizationSampler::UtilizationSampler()
+    : platform(nullptr), started(false), closed(false), intervalMs(500),
+    cpu(0.0), gpu(-1.0), disk(-1.0) {
+}
+
+UtilizationSampler::~UtilizationSampler() {
+    platform_release(platform);
+}
+
+void UtilizationSampler::begin(unsigned interval) {
+    lock_guard<mutex> lock(m);
+    beginLocked(interval);
+}
+
+void UtilizationSampler::beginLocked(unsigned interval) {
+    if (started) return;
+
+    intervalMs = interval;
+    platform_baseline(platform);
+    baselineAt = chrono::steady_clock::now();
+    started = true;
+}
+
+// The first reader pays for the rest of the window, everyone else
+// (including readers blocked on the mutex meanwhile) reuses the result.
+// Caller holds the lock, and copies the result out before releasing it:
+// nextWindow() may close the next window right after.
+void UtilizationSampler::closeLocked() {
+    if (closed) return;
+    beginLocked(intervalMs); // no-op unless the module is used without main() calling begin()
+
+    auto due = baselineAt + chrono::milliseconds(intervalMs);
+    this_thread::sleep_until(due);
+
+    closedAt = chrono::steady_clock::now();
+    double elapsedMs = chrono::duration<double, milli>(closedAt - baselineAt).count();
+    cores.clear();
+    platform_close(platform, cpu, cores, gpu, disk, elapsedMs);
+    closed = true;
+}
+
+void UtilizationSampler::nextWindow() {
+    lock_guard<mutex> lock(m);
+    if (!closed) return;
+    baselineAt = closedAt;
+    closed = false;
+}
+
+double UtilizationSampler::cpuPercent() {
+    lock_guard<mutex> lock(m);
+    closeLocked();
+    return cpu;
+}
+
+vector<double> UtilizationSampler::perCorePercent() {
+    lock_guard<mutex> lock(m);
+    closeLocked();
+    return cores;
+}
+
+double UtilizationSampler::gpuPercent() {
+    lock_guard<mutex> lock(m);
+    closeLocked();
+    return gpu;
+}
+
+double UtilizationSampler::diskPercent() {
+    lock_guard<mutex> lock(m);
+    closeLocked();
+    return disk;
+}
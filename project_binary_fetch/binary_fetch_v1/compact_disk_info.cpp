@@ -1,4 +1,4 @@
-#include "include\compact_disk_info.h"
+#include "include/compact_disk_info.h"
 #include <windows.h>
 using namespace std;
 DiskInfo::DiskInfo() {
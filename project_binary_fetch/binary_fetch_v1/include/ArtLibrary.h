@@ -0,0 +1,97 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "MappedFile.h"
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                    ArtLibrary Class
+ ---------------------------------------------------------
+
+  BinaryARTS.txt holds a whole collection of arts, one
+  after the other, separated by empty lines. An art can be
+  given a name and tags with an "@art" line right before it:
+
+     @art windows-logo windows microsoft
+     $1 ###### $3 <<<<<<
+     ...
+
+  Every art is reachable by its number (1 = first in the
+  file), and named ones by name or by tag (case-insensitive).
+  A line holding a single space keeps a gap inside an art.
+
+  The text is parsed once into an index, BinaryARTS.idx
+  beside it: the lines with their $n color codes already
+  expanded and their visible widths measured, the line
+  table of every art, and a hash table of names and tags.
+  open() maps that file while the text is unchanged (same
+  last-write time and size), so picking an art is one hash
+  probe and only the pages of the chosen art are read - the
+  cost doesn't grow with the size of the collection.
+
+     ArtLibrary lib;
+     if (lib.open("BinaryARTS.txt")) {
+         int n = lib.find("windows-logo");     // or lib.findForSystem()
+         if (n >= 0) art.loadFromLibrary(lib, n);
+     }
+
+  If the index can't be written (read-only folder) the one
+  built in memory is used for this run.
+*/
+class ArtLibrary {
+public:
+    // one art line: color codes expanded, not NUL terminated
+    struct Line {
+        const char* data;
+        size_t size;
+        int width;                 // visible columns
+    };
+
+    ArtLibrary();
+
+    // map <textPath w/o ext>.idx if it is current (reuse = true),
+    // otherwise parse the text, build the index and save it
+    bool open(const string& textPath, bool reuse = true);
+
+    // the index came from the .idx file, not from a parse
+    bool isIndexed() const { return image != nullptr && image == index.data(); }
+
+    // art by name, tag, or number ("3"); -1 if there is none
+    int find(const string& key) const;
+
+    // first art tagged with one of systemTags(); -1 if there is none
+    int findForSystem() const;
+
+    // what this machine is, most specific first:
+    // "ubuntu", "debian", "linux", "intel" / "windows", "amd"
+    static vector<string> systemTags();
+
+    size_t size() const;                       // number of arts
+    string name(int art) const;                // "" for unnamed arts
+    int height(int art) const;
+    int maxWidth(int art) const;
+
+    // line <i> of <art>; empty for anything out of range
+    Line line(int art, int i) const;
+
+    struct Header;                 // index layout (ArtLibrary.cpp)
+    struct Art;
+    struct LineRecord;
+
+private:
+    ArtLibrary(const ArtLibrary&) = delete;
+    ArtLibrary& operator=(const ArtLibrary&) = delete;
+
+    vector<char> owned;            // index built by build()
+    MappedFile index;              // index mapped by open()
+    const char* image;             // one of the two, null while empty
+    string indexPath;
+
+    void build(const string& text, unsigned long long time, unsigned long long size);
+    bool validate(const char* data, size_t size) const;
+    const Art* art(int n) const;
+    int lookup(unsigned kind, const char* key, size_t length) const;
+};
@@ -18,20 +18,20 @@
 // Removes ANSI color escape codes so width calculations stay correct
 std::string stripAnsiSequences(const std::string& s);
 
-// Converts UTF-8 text to wide string (needed for width calculation)
-std::wstring utf8_to_wstring(const std::string& s);
-
-// Returns how "wide" a Unicode character appears when printed.
-// Some characters take 2 columns (Asian chars, emojis).
-int char_display_width(wchar_t wc);
-
 // Measures how many *visible* characters a UTF-8 string occupies.
+// ANSI codes count as 0, Asian chars and emojis as 2 (see TextWidth.h).
 size_t visible_width(const std::string& s);
 
+// Expands $n color codes (see the list at the end of AsciiArt.cpp)
+// and ends the line with a reset.
+std::string processColorCodes(const std::string& line);
+
 // Some ASCII art lines may start with invisible ANSI codes.
 // This trims them so alignment doesn't break.
 void sanitizeLeadingInvisible(std::string& s);
 
+class ArtLibrary;
+
 
 
 /*
@@ -61,6 +61,10 @@ public:
     // Advanced: Load from custom path (overrides default behavior)
     bool loadFromFile(const std::string& customPath);
 
+    // Take art number <art> of a BinaryARTS.txt collection (see ArtLibrary.h).
+    // Lines come pre-expanded and measured, nothing is parsed here.
+    bool loadFromLibrary(const ArtLibrary& library, int art);
+
     // Whether ASCII art printing is turned on
     bool isEnabled() const;
     void setEnabled(bool enable);
@@ -112,15 +116,41 @@ private:
 
   This allows the system info to appear gradually while the
   ASCII art stays on the left, properly aligned.
+
+  Output is composed in one buffer (padding filled in place)
+  and handed to the terminal in a single write() / WriteFile
+  per flush, instead of a dozen small cout writes per line:
+
+     Live      flush after every push (one write per line,
+               or per batch with push(vector))
+     Buffered  flush only in finish(), or whenever the frame
+               grows past flushBytes (0 = whole frame at once)
+
+  Over SSH / in slow terminals Buffered means one syscall
+  and one repaint for the whole output.
+
+  Watch mode (--watch): after keepFrame() the printer
+  remembers the info line of every row. Once finish() has
+  put the cursor below the frame, repaint() takes the next
+  frame and rewrites only the cells that differ - the cursor
+  is moved up from the bottom row and across the art column
+  (maxWidth + spacing), so unchanged text and the art are
+  never sent again. A tick where one number changes costs a
+  few dozen bytes.
 */
 class LivePrinter {
 public:
-    LivePrinter(const AsciiArt& artRef);
+    enum class Mode { Live, Buffered };
+
+    LivePrinter(const AsciiArt& artRef, Mode mode = Mode::Live, size_t flushBytes = 0);
 
     // Push a single line of system info.
     // Each call prints the next art line (or blank padding).
     void push(const std::string& infoLine);
 
+    // Push several lines; in Live mode they go out in one write
+    void push(const std::vector<std::string>& infoLines);
+
     // Same as push("")  convenient for spacing
     void pushBlank();
 
@@ -128,12 +158,38 @@ public:
     // ASCII art lines that weren't paired with info.
     void finish();
 
+    // Write everything composed so far (no-op if nothing is pending)
+    void flush();
+
+    // Watch mode: remember each row's info line (call before the first push)
+    void keepFrame();
+
+    // After finish(): bring the screen to <infoLines> by rewriting just the
+    // changed cells, in one write. Rows more than screenRows - 1 above the
+    // bottom are off screen and left alone (0 = all visible).
+    // Returns the number of cells written.
+    size_t repaint(const std::vector<std::string>& infoLines, int screenRows = 0);
+
+    // What reached the terminal so far (for --stats)
+    size_t writeCount() const { return writes; }
+    size_t bytesWritten() const { return bytes; }
+
 private:
     const AsciiArt& art;   // reference to the loaded ASCII art
     int index;             // which art line we are currently on
-
-    // Core helper: prints the art line + spacing
+    Mode mode;
+    size_t flushBytes;     // Buffered: flush once the frame is this big (0 = never early)
+    std::string frame;     // composed output not written yet
+    size_t writes;
+    size_t bytes;
+    bool keep;                         // keepFrame() was called
+    std::vector<std::string> shown;    // info line of every row on screen
+
+    // Core helper: appends the art line + padding + spacing to the frame
     void printArtAndPad();
+
+    // art + padding + info + newline, into the frame
+    void appendLine(const std::string& infoLine);
 };
 
 
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+#include <mutex>
+#include "DiskBenchmark.h"
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                  BenchmarkCache Class
+ ---------------------------------------------------------
+
+  The disk and network speed tests are the slowest part of
+  a run, and their results hardly move from one day to the
+  next. StaticCache can't hold them (it is dropped at every
+  reboot), so they get a file of their own beside the
+  config, BinaryFetch_Bench.json, keyed by what was measured
+  rather than by the boot:
+
+     "disk:serial:S4EWNF0M123456"     a drive (serial / WWN)
+     "net:A4:B1:C1:23:8F:99>00:11:22:33:44:55:download"
+                                      an interface behind a
+                                      gateway (its MAC)
+
+  Each entry carries the unix time it was measured at. A
+  lookup succeeds while the entry is younger than the max
+  age, and tells how old it is so the row can say so. A
+  disk entry also carries the speed test settings it was
+  measured with (write test on, queue depth, durations, file
+  size); a lookup with other settings misses:
+
+     BenchmarkCache& cache = BenchmarkCache::instance();
+     long long age;
+     if (!cache.disk(id, options, report, age)) {
+         ... benchmark ...
+         cache.storeDisk(id, options, report);
+     }
+
+  After load(dir, false) (--rebench) every lookup misses,
+  so everything is measured again; entries of devices not
+  seen this run stay in the file. Only successful results
+  are stored.
+*/
+class BenchmarkCache {
+public:
+    static BenchmarkCache& instance();
+
+    // read <directory>/BinaryFetch_Bench.json; entries older than
+    // maxAgeSeconds are ignored, reuse = false ignores all of them
+    void load(const string& directory, bool reuse, long long maxAgeSeconds);
+
+    // write the file back if something was stored
+    void save();
+
+    // cached report of a drive measured with <options>, age = seconds
+    // since it was measured
+    bool disk(const string& id, const BenchmarkOptions& options, DiskBenchmarkReport& report, long long& age);
+    void storeDisk(const string& id, const BenchmarkOptions& options, const DiskBenchmarkReport& report);
+
+    // cached text result ("45.3 Mbps") of any other test
+    bool text(const string& id, string& value, long long& age);
+    void storeText(const string& id, const string& value);
+
+    // "<1m", "5m", "3h", "2d"
+    static string formatAge(long long seconds);
+
+    struct State;                  // parsed file (BenchmarkCache.cpp)
+
+private:
+    BenchmarkCache();
+    ~BenchmarkCache();
+    BenchmarkCache(const BenchmarkCache&) = delete;
+    BenchmarkCache& operator=(const BenchmarkCache&) = delete;
+
+    State* state;
+    mutex m;
+    string path;                   // empty until load()
+    bool reuse;
+    long long maxAge;
+    bool dirty;
+};
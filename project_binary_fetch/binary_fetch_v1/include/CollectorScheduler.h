@@ -0,0 +1,151 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+#include "AsciiArt.h"
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                 CollectorScheduler Class
+ ---------------------------------------------------------
+
+  Runs every enabled section of main.cpp on a small worker
+  pool instead of one after another.
+
+  Each section is registered as a job. The job gets a
+  SectionBuffer instead of the real LivePrinter, so the
+  section code keeps calling lp.push(...) exactly like
+  before - the lines just land in that section's slot.
+
+  run() is the reorder buffer: it walks the slots in the
+  order they were added and streams their lines through
+  LivePrinter::push as soon as they show up. A slow section
+  only holds back the sections *after* it on screen, it
+  never holds back their collection.
+
+  Sections sharing the same "lane" never run at the same
+  time (used for the NVAPI users, which Initialize/Unload
+  the library on their own).
+
+  Deadlines: every section may get a timeout (timeout_ms in
+  its config block) and the whole run may get a budget
+  (--budget <ms>). Both count from the moment the scheduler
+  was created. A section that misses its deadline is shown
+  as the placeholder line and whatever it produces later is
+  thrown away, so one hung call can't stall the stream.
+  It still holds its lane until it returns, so the sections
+  queued behind it in that lane are dropped and show the
+  placeholder too (they'd have no deadline of their own).
+  Such a job can't be cancelled though: run() / stop() then
+  detach the pool, and if detached() is true main() must
+  leave without unwinding.
+
+  Watch mode (--watch): after keepAlive(), run() leaves the
+  pool and the jobs in place. Every tick() then queues the
+  repeating sections again (time, usage, memory...) on the
+  same workers and returns the whole frame - fresh lines for
+  those, the lines of the first run for everything else.
+  Deadlines count from the start of each tick.
+*/
+
+class CollectorScheduler;
+
+// Line sink handed to a section job (mirrors LivePrinter::push)
+class SectionBuffer {
+public:
+    void push(const string& line);
+
+private:
+    friend class CollectorScheduler;
+    SectionBuffer(CollectorScheduler& owner, size_t slot) : owner(owner), slot(slot) {}
+
+    CollectorScheduler& owner;
+    size_t slot;
+};
+
+class CollectorScheduler {
+public:
+    using Job = function<void(SectionBuffer&)>;
+
+    // workers = 0 -> pick a pool size from the hardware
+    CollectorScheduler(LivePrinter& printer, unsigned workers = 0);
+    ~CollectorScheduler();
+
+    // queue a section; it may start running right away
+    void add(const string& name, Job job);
+    void add(const string& name, const string& lane, Job job);
+
+    // deadlines (0 = no limit), counted from construction
+    void setBudget(unsigned ms);
+    void setTimeout(const string& name, unsigned ms);
+    void setPlaceholder(const string& text);
+
+    // stream every section in registration order, then join the pool
+    // (unless keepAlive() was called)
+    void run();
+
+    // --watch: keep the workers and the jobs for tick()
+    void keepAlive();
+    void setRepeating(const string& name, bool repeat);
+
+    // collect the repeating sections again and fill <lines> with every
+    // section's lines in order (the placeholder for late ones)
+    void tick(vector<string>& lines);
+
+    // --watch is over: let the workers go (joined, or detached like run())
+    void stop();
+
+    // run() / stop() left a timed out section running on a detached worker:
+    // the scheduler must outlive it, so the process has to _exit()
+    bool detached() const;
+
+private:
+    friend class SectionBuffer;
+
+    struct Slot {
+        string name;
+        string lane;
+        Job job;
+        vector<string> lines;   // produced by the worker, drained by run()
+        bool done = false;
+        bool abandoned = false; // missed its deadline, output is ignored
+        bool running = false;   // on a worker right now
+        bool repeat = false;    // collected again on every tick()
+    };
+
+    LivePrinter& lp;
+    vector<thread> pool;
+    vector<unique_ptr<Slot>> slots;
+    deque<size_t> pending;      // slot indices not picked up yet
+    map<string, size_t> laneOwner; // lane -> slot currently holding it
+    bool sealed;                // run() was called, no more add()
+    bool alive;                 // keepAlive(): workers wait for tick() instead of leaving
+    bool leftRunning;           // release() detached the pool (see detached())
+
+    chrono::steady_clock::time_point startedAt;
+    unsigned budgetMs;
+    map<string, unsigned> timeouts;
+    map<string, bool> repeating;
+    string placeholder;
+
+    mutex m;
+    condition_variable workReady;
+    condition_variable lineReady;
+
+    void workerLoop();
+    bool takeJob(size_t& index);
+    void append(size_t index, const string& line);
+    bool deadlineFor(const Slot& slot, chrono::steady_clock::time_point& deadline) const;
+    void abandon(size_t index);
+    void dropLane(const string& lane);
+    void release();
+};
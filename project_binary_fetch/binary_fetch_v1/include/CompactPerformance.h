@@ -5,6 +5,7 @@ class CompactPerformance {
 public:
     int getCPUUsage();
     int getRAMUsage();
-    int getDiskUsage();
+    int getDiskUsage();  // space used on C:
+    int getDiskBusy();   // physical disk busy time
     int getGPUUsage(); // NVIDIA -> NVAPI, otherwise Windows PDH
 };
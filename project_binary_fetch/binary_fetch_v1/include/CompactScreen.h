@@ -2,7 +2,9 @@
 
 #include <string>
 #include <vector>
+#ifdef _WIN32
 #include <windows.h>
+#endif
 using namespace std;
 struct ScreenInfo {
     string name;           // Friendly display name (e.g., "ASUS VG27AQ")
@@ -45,6 +47,7 @@ private:
     bool populateFromDXGI();
     bool enrichWithNVAPI();
     bool enrichWithADL();
+    bool populateFromDRM();   // Linux: /sys/class/drm (CompactScreenLinux.cpp)
 
     // Helper to get friendly name from EDID
     string getFriendlyNameFromEDID(const wstring& deviceName);
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <atomic>
+#include <initializer_list>
+#include <cstring>
+#include <cstddef>
+#include "nlohmann/json.hpp"
+#include "MappedFile.h"
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                    ConfigIndex Class
+ ---------------------------------------------------------
+
+  main.cpp asks the config ~700 questions per run ("is
+  cpu.show_cores on?", "which color is header.title_color?").
+  Answering each one by walking nlohmann::json objects
+  (contains() + operator[] per level, deep copies for dotted
+  paths) costs far more than collecting some of the data.
+
+  compile() walks the parsed config ONCE and flattens every
+  node into one table keyed by its dotted path:
+
+     "cpu.show_cores"                         -> true
+     "header.colors.title_color"              -> "\033[32m"
+     "detailed_storage.storage_summary.header.show_header"
+
+  Color names are resolved to their ANSI sequence right
+  there and booleans are packed into a bitset, so a renderer
+  gets the escape code / flag back directly.
+
+  Lookups hash the path pieces in place (no joined string,
+  no allocation) into an open addressing table:
+
+     bool on = index.flag({ "cpu", "show_cores" });
+     const string& c = index.color({ "header", "colors", "title_color" }, "white");
+
+  Snapshot:
+  the compiled table is one flat, pointer-free image, and
+  save() writes it beside the JSON (BinaryFetch_Config.json
+  -> BinaryFetch_Config.bin). load() maps that file straight
+  into memory and uses it as is - no JSON parse at all - as
+  long as it was compiled from the JSON as it is now:
+    - same last-write time and size, or
+    - (time changed) the same content hash
+  with the same color palette. Otherwise load() fails and
+  the caller parses + compiles + saves again, so editing
+  the config just works on the next run.
+
+  The index is read-only after compile() / load(), so the
+  collector threads can share it. lookups() counts every
+  lookup for --stats; tests/config_bench.cpp also counts
+  the allocations, against the old json walk.
+*/
+
+// Borrowed text: a string literal or a std::string, never copied
+struct ConfigKey {
+    const char* data;
+    size_t size;
+
+    ConfigKey(const char* s) : data(s), size(strlen(s)) {}
+    ConfigKey(const string& s) : data(s.data()), size(s.size()) {}
+};
+
+class ConfigIndex {
+public:
+    // colors: color name -> ANSI sequence ("red" -> "\033[31m")
+    explicit ConfigIndex(const map<string, string>& colors);
+    ~ConfigIndex();
+
+    // map the snapshot beside <jsonPath> if it is still current;
+    // reuse = false only records the JSON stamp for save()
+    bool load(const string& jsonPath, bool reuse = true);
+
+    // flatten <config>; <text> is the JSON it was parsed from (hashed
+    // into the snapshot). A non-object config leaves the index empty
+    void compile(const nlohmann::json& config, const string& text);
+
+    // write the compiled image beside the JSON given to load()
+    bool save() const;
+
+    // the table came from the snapshot file, not from a parse
+    bool isSnapshot() const { return image != nullptr && image == snapshot.data(); }
+
+    // a node (of any kind) exists at { "a", "b", "c" };
+    // a piece may itself be dotted: "b.c"
+    bool has(initializer_list<ConfigKey> path) const;
+
+    // boolean at the path, fallback if missing or not a boolean
+    bool flag(initializer_list<ConfigKey> path, bool fallback = true) const;
+
+    // number / string at the path, fallback if missing or another kind
+    double number(initializer_list<ConfigKey> path, double fallback) const;
+    string text(initializer_list<ConfigKey> path, const string& fallback) const;
+
+    // ANSI sequence of a color name; "white" for unknown names
+    const string& color(ConfigKey name) const;
+
+    // ANSI sequence named at the path, color(fallback) if missing / unknown
+    const string& color(initializer_list<ConfigKey> path, ConfigKey fallback) const;
+
+    // top level objects ("cpu", "compact_time"...), in config order
+    vector<string> sections() const;
+
+    size_t size() const;
+    size_t lookups() const { return lookupCount.load(memory_order_relaxed); }
+
+    struct Header;                 // image layout (ConfigIndex.cpp)
+    struct Entry;
+
+private:
+    ConfigIndex(const ConfigIndex&) = delete;
+    ConfigIndex& operator=(const ConfigIndex&) = delete;
+
+    vector<pair<string, string>> palette;   // color name -> ANSI, searched linearly (15 names)
+    unsigned long long paletteHash;
+
+    vector<char> owned;            // image built by compile()
+    MappedFile snapshot;           // image mapped by load()
+    const char* image;             // one of the two, null while empty
+
+    string snapshotPath;           // set by load()
+    unsigned long long sourceTime; // JSON stamp, taken before it is read
+    unsigned long long sourceSize;
+
+    mutable atomic<size_t> lookupCount{ 0 };
+
+    const Entry* find(initializer_list<ConfigKey> path) const;
+    bool validate(const char* data, size_t size) const;
+};
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                  DiskBenchmark Class
+ ---------------------------------------------------------
+
+  The old speed test timed ONE 32 MB WriteFile and ONE
+  ReadFile: a single request in flight, no warm-up, and a
+  result that mostly measured the first request. Fast NVMe
+  drives only show their speed with many requests queued.
+
+  The benchmark runs four tests, bypassing the OS cache:
+
+     sequential read  / write   1 MiB blocks
+     random read      / write   4 KiB blocks, aligned
+
+  By default nothing is written. runReadOnly() reads the
+  device itself (/dev/sda, \\.\PhysicalDrive0) at aligned
+  offsets across its whole span, or - without the rights
+  for that - an existing large file found by findLargeFile().
+  Only the two read tests run there.
+
+  Each test keeps <queueDepth> requests in flight, runs
+  <warmupMs> unmeasured, then <durationMs> measured:
+  throughput, IOPS and the p50 / p99 / p99.9 completion
+  latency of that window.
+
+  Windows : FILE_FLAG_NO_BUFFERING + overlapped I/O on an
+            I/O completion port
+  Linux   : O_DIRECT + io_uring (raw syscalls, no liburing);
+            one pread / pwrite thread per queue slot where
+            io_uring is unavailable (old kernel, seccomp)
+
+     BenchmarkOptions options;                 // defaults below
+     DiskBenchmarkReport report;
+     if (DiskBenchmark::runReadOnly("/dev/nvme0n1", options, report)) {
+         report.seqRead.mbps; report.randRead.iops; report.randRead.p99Us;
+     }
+
+  The write tests (run()) are opt-in: options.write = true.
+  They use a scratch file in the given folder, written
+  before anything is read (a hole would be "read" without
+  touching the device) and flushed to the media. It never
+  outlives the process, whatever ends it: on Linux it is
+  unlinked right after open(), on Windows it is opened
+  with FILE_FLAG_DELETE_ON_CLOSE. All writes together stay
+  within options.writeBudgetMb, and a volume with less than
+  the file + 1 GiB free is not written to at all.
+
+  DiskBenchmarkBatch runs one benchmark per physical device,
+  up to <parallelDevices> devices at once: volumes /
+  partitions of one device would only compete for it,
+  separate devices don't. A 12 disk machine waits for its
+  slowest disk, not for all 12.
+
+     DiskBenchmarkBatch batch(options);
+     batch.add("PhysicalDrive0", { "C:\\", "C:\\Temp\\" }, "\\\\.\\PhysicalDrive0");
+     batch.add("PhysicalDrive1", { "D:\\" }, "\\\\.\\PhysicalDrive1");
+     batch.start();
+     const DiskBenchmarkReport& r = batch.wait("PhysicalDrive1");
+*/
+
+struct BenchmarkOptions {
+    unsigned queueDepth = 32;           // requests in flight per test
+    unsigned durationMs = 250;          // measured window of each test
+    unsigned warmupMs = 50;             // unmeasured lead-in of each test
+    unsigned fileMb = 64;               // scratch file size, smallest file findLargeFile() takes
+    bool write = false;                 // DiskBenchmarkBatch: run the write tests
+    unsigned writeBudgetMb = 256;       // most a run() may write, fill included
+    unsigned parallelDevices = 8;       // DiskBenchmarkBatch: disks measured at once
+};
+
+struct BenchmarkResult {
+    bool ok = false;
+    double mbps = 0.0;                  // MiB/s over the measured window
+    double iops = 0.0;
+    double p50Us = 0.0;                 // completion latency, microseconds
+    double p99Us = 0.0;
+    double p999Us = 0.0;
+    unsigned long long ops = 0;         // requests completed in the window
+};
+
+struct DiskBenchmarkReport {
+    bool ok = false;                    // at least one test produced a result
+    string engine;                      // "io_uring", "threads", "iocp"
+    string source;                      // "scratch file", or the device / file read
+    BenchmarkResult seqRead;
+    BenchmarkResult seqWrite;
+    BenchmarkResult randRead;
+    BenchmarkResult randWrite;
+};
+
+class DiskBenchmark {
+public:
+    // benchmark the device holding <directory> (a trailing separator is
+    // optional) with a scratch file, writes included; false if the file
+    // could not be created there or the volume is nearly full
+    static bool run(const string& directory, const BenchmarkOptions& options, DiskBenchmarkReport& report);
+
+    // read tests only, on a block device or an existing file; false if
+    // it can't be opened unbuffered (no rights, no O_DIRECT)
+    static bool runReadOnly(const string& path, const BenchmarkOptions& options, DiskBenchmarkReport& report);
+
+    // the largest dense, readable file of at least <minBytes> a short
+    // walk below <directories> finds (same filesystem); "" if none
+    static string findLargeFile(const vector<string>& directories, unsigned long long minBytes);
+};
+
+class DiskBenchmarkBatch {
+public:
+    explicit DiskBenchmarkBatch(const BenchmarkOptions& options) : options(options) {}
+    ~DiskBenchmarkBatch();                  // waits for every job
+
+    // folders on <device>, tried in order for the scratch file (when
+    // options.write) and searched for a large file; <node> is the device
+    // to read directly ("" if unknown). Adding the same device again
+    // appends to its list
+    void add(const string& device, const vector<string>& directories, const string& node);
+
+    // up to options.parallelDevices threads, devices in add() order
+    void start();
+
+    // block until <device> is done; an empty report for unknown devices
+    // or when nothing on the device could be measured
+    const DiskBenchmarkReport& wait(const string& device);
+
+private:
+    DiskBenchmarkBatch(const DiskBenchmarkBatch&) = delete;
+    DiskBenchmarkBatch& operator=(const DiskBenchmarkBatch&) = delete;
+
+    struct Job {
+        vector<string> directories;
+        string node;
+        DiskBenchmarkReport report;
+        bool done = false;
+    };
+
+    void work();                            // one worker: jobs until none is left
+
+    BenchmarkOptions options;
+    map<string, unique_ptr<Job>> jobs;
+    vector<Job*> order;                     // jobs in add() order
+    size_t next = 0;                        // first job no worker took yet
+    vector<thread> workers;
+    mutex m;
+    condition_variable finished;
+};
@@ -42,6 +42,7 @@ private:
     bool populateFromDXGI();
     bool enrichWithNVAPI();
     bool enrichWithADL();
+    bool populateFromDRM();   // Linux: /sys/class/drm (DisplayInfoLinux.cpp)
 
     // Helpers (mirrors CompactScreen)
     static string WideToUtf8(const wchar_t* w);
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <functional>
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                     FactStore Class
+ ---------------------------------------------------------
+
+  Several modules show the same underlying fact in their
+  own format: uptime has four renderers (CompactOS, OSInfo,
+  CPUInfo, PerformanceInfo), GPUInfo / DetailedGPUInfo /
+  CompactGPU each walked the DXGI adapters, and the compact
+  network line asked WLAN for the SSID twice.
+
+  The FactStore is a per-run cache keyed by FactId. The
+  first reader of a fact runs its probe, every later reader
+  (from any module, on any worker thread) gets the stored
+  value. Readers arriving while the probe is still running
+  wait for it instead of probing again.
+
+     unsigned long long ms = FactStore::uptimeMs();
+
+  Each fact also counts hits and misses, so a run with
+  --stats shows that every probe ran exactly once.
+
+  In watch mode (--watch) the store lives for the whole
+  session: expireVolatile() drops the facts that change
+  while BinaryFetch runs (uptime, SSID, network) before each
+  tick, the GPU list is probed once.
+*/
+
+// One entry per shared fact. Every id always holds the same type.
+enum class FactId {
+    UptimeMs,       // unsigned long long, ms since boot
+    GpuAdapters,    // vector<GpuAdapter>
+    WifiSsid,       // string, "" when not on WiFi
+    Network,        // NetSnapshot (Linux: one netlink dump)
+    Count
+};
+
+// One display adapter as reported by DXGI (Linux: a DRM card)
+struct GpuAdapter {
+    string name;                     // UTF-8 description
+    unsigned vendorId = 0;           // 0x10DE NVIDIA, 0x1002 AMD, 0x8086 Intel...
+    unsigned long long vramBytes = 0; // dedicated video memory
+    string driverVersion;            // "a.b.c.d" or "Unknown"
+};
+
+// One IPv4 / IPv6 address of an interface
+struct NetAddress {
+    int family = 0;                  // AF_INET / AF_INET6
+    string address;                  // "192.168.0.9"
+    int prefix = 0;                  // 24
+};
+
+// One network interface with everything the network sections show
+struct NetInterface {
+    int index = 0;
+    string name;                     // "enp3s0", "wlan0"
+    string mac;                      // "A4:B1:C1:23:8F:99", "" if none
+    string operState;                // "up", "down", "dormant"...
+    bool loopback = false;
+    bool wireless = false;
+    long long speedMbps = -1;        // link speed, -1 when unknown
+    vector<NetAddress> addresses;
+};
+
+// All interfaces plus the one carrying the default route
+struct NetSnapshot {
+    vector<NetInterface> interfaces;
+    int activeIndex = 0;             // ifindex of the default route, 0 if none
+
+    // default route interface, else the first "up" one with IPv4; null if none
+    const NetInterface* active() const;
+};
+
+class FactStore {
+public:
+    static FactStore& instance();
+
+    // value of the fact, running probe() only if nobody did it before
+    template <typename T>
+    T get(FactId id, const function<T()>& probe) {
+        Entry& e = entries[static_cast<size_t>(id)];
+        lock_guard<mutex> lock(e.m);
+        if (e.value) {
+            ++e.hits;
+        }
+        else {
+            ++e.misses;
+            e.value = make_shared<T>(probe());
+        }
+        return *static_pointer_cast<T>(e.value);
+    }
+
+    // the next get() of a volatile fact runs its probe again
+    void expireVolatile();
+
+    unsigned hits(FactId id) const { return entries[static_cast<size_t>(id)].hits; }
+    unsigned misses(FactId id) const { return entries[static_cast<size_t>(id)].misses; }
+    static const char* name(FactId id);
+
+    // -------- shared facts (probes live in FactStore.cpp) --------
+    static unsigned long long uptimeMs();
+    static vector<GpuAdapter> gpuAdapters();
+    static string wifiSsid();
+    static NetSnapshot network();
+
+private:
+    FactStore() = default;
+    FactStore(const FactStore&) = delete;
+    FactStore& operator=(const FactStore&) = delete;
+
+    struct Entry {
+        mutex m;
+        shared_ptr<void> value;
+        atomic<unsigned> hits{ 0 };
+        atomic<unsigned> misses{ 0 };
+    };
+
+    Entry entries[static_cast<size_t>(FactId::Count)];
+};
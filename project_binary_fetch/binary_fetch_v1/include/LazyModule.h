@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                  LazyModule<T> Template
+ ---------------------------------------------------------
+
+  main() used to construct every info class up front, and
+  some of them do real work in their constructors
+  (MemoryInfo runs a WMI query, DisplayInfo walks DXGI...).
+
+  LazyModule<T> is the collector registry entry for one
+  module: it only builds T the first time a section touches
+  it, so a section that is disabled in the config costs
+  nothing at all.
+
+     LazyModule<MemoryInfo> ram;     // nothing happens here
+     ram->getTotal();                // constructed here (once)
+
+  Sections run on the scheduler's worker pool, so the first
+  construction is guarded by call_once.
+*/
+template <typename T>
+class LazyModule {
+public:
+    LazyModule() = default;
+    LazyModule(const LazyModule&) = delete;
+    LazyModule& operator=(const LazyModule&) = delete;
+
+    T& get() {
+        call_once(once, [this] { instance.reset(new T()); });
+        return *instance;
+    }
+
+    T* operator->() { return &get(); }
+    T& operator*() { return get(); }
+
+    // true once some section actually needed the module
+    bool constructed() const { return instance != nullptr; }
+
+private:
+    once_flag once;
+    unique_ptr<T> instance;
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <initializer_list>
+#include "ConfigIndex.h"
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                    LineTemplate Class
+ ---------------------------------------------------------
+
+  A section line described as data instead of an
+  ostringstream block. The template comes from the
+  section's "template" key in the config:
+
+     "compact_cpu": {
+       "template": "{color:CPU}CPU{reset}: {name} @ {clock:.2f} GHz"
+     }
+
+  Syntax:
+     {field}            a value the section provides (name, clock...)
+     {field:.2f}        a number with 2 decimals (default: like cout)
+     {color:key}        the section's color <key> (colors block), or a
+                        palette name ("red"); unknown -> white
+     {reset}            back to the terminal color
+     {if:flag} ... {end}
+                        only kept when the section's flag is on
+                        (flag, a|b = either, a&b = both)
+     {{  }}             literal braces
+
+  compile() runs once at load. Colors and {if} flags can't
+  change while running, so they are decided right there:
+  escape codes are copied into the literal text and disabled
+  groups are dropped. What is left is a flat list of literal
+  spans and field references, and render() is one loop over
+  it into a buffer the caller reuses - no allocation once the
+  buffer has grown to the line's size.
+
+     LineTemplate t;
+     t.compile(source, cfg, "compact_cpu", { "name", "clock" });
+     if (t.uses("clock")) ...
+     t.render({ name, cpu.getClockSpeed() }, line);
+*/
+
+// One field value, borrowed: strings must outlive render()
+struct TemplateValue {
+    enum class Kind { Text, Integer, Real };
+
+    Kind kind;
+    const char* text = "";
+    size_t size = 0;
+    long long integer = 0;
+    double real = 0.0;
+
+    TemplateValue(const string& s) : kind(Kind::Text), text(s.data()), size(s.size()) {}
+    TemplateValue(const char* s) : kind(Kind::Text), text(s), size(strlen(s)) {}
+    TemplateValue(int v) : kind(Kind::Integer), integer(v) {}
+    TemplateValue(long long v) : kind(Kind::Integer), integer(v) {}
+    TemplateValue(double v) : kind(Kind::Real), real(v) {}
+};
+
+class LineTemplate {
+public:
+    // <section> supplies the colors and {if} flags, <fields> names the
+    // values render() receives, in order. false + error() on bad syntax
+    bool compile(const string& source, const ConfigIndex& cfg, ConfigKey section,
+        initializer_list<const char*> fields);
+
+    // the line (as configured) shows <field>: skip probing it otherwise
+    bool uses(const char* field) const;
+
+    // <out> is cleared and refilled
+    void render(initializer_list<TemplateValue> values, string& out) const;
+
+    const string& error() const { return message; }
+    size_t opCount() const { return ops.size(); }
+
+private:
+    struct Op {
+        int field;                 // -1: literal text[offset, offset + size)
+        int precision;             // fields: digits after the point, -1 = like cout
+        size_t offset;
+        size_t size;
+    };
+
+    string text;                   // every literal span, colors included
+    vector<Op> ops;
+    vector<string> fieldNames;
+    vector<bool> used;
+    string message;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+#include <vector>
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                    LinuxDrm helpers
+ ---------------------------------------------------------
+
+  The kernel's DRM layer publishes every display connector
+  under /sys/class/drm/card<N>-<connector>/:
+
+     status   "connected" / "disconnected"
+     modes    supported modes, preferred (native) one first
+     edid     raw EDID bytes of the attached monitor
+
+  That is everything DisplayInfo / CompactScreen need, with
+  no X11 / Wayland library and no display server running, so
+  it works the same on a headless box or in a VT.
+
+     for (const auto& out : drm_connected_outputs()) ...
+
+  The GPUs themselves are the bare card<N> entries. Their
+  device/ directory (the PCI device) is walked once per card:
+
+     uevent               PCI_ID, PCI_SLOT_NAME, DRIVER
+     mem_info_vram_total  VRAM (amdgpu)
+     gpu_busy_percent     load (amdgpu)
+     pp_dpm_sclk          current shader clock, the '*' line
+     hwmon/hwmonN/        temp1_input, freq1_input
+
+     for (const auto& gpu : drm_gpu_cards()) ...
+
+  The sysfs root is a parameter: point it at a captured copy
+  of /sys/class/drm to replay another machine's outputs.
+  Nothing here exists on Windows.
+*/
+#ifndef _WIN32
+
+struct DrmOutput {
+    string card;                     // "card0"
+    string connector;                // "HDMI-A-1", "eDP-1"
+    vector<pair<int, int>> modes;    // {1920, 1080}, ... preferred first
+    vector<unsigned char> edid;      // empty if the monitor sent none
+};
+
+// One GPU (card<N>) with whatever its driver exposes; -1 / 0 when it doesn't
+struct DrmGpu {
+    string card;                     // "card0"
+    unsigned vendorId = 0;           // 0x1002 AMD, 0x10DE NVIDIA, 0x8086 Intel...
+    unsigned deviceId = 0;
+    string driver;                   // "amdgpu", "i915", "nouveau", "nvidia"
+    string driverVersion;            // module version, "" if the module has none
+    string pciSlot;                  // "0000:03:00.0"
+    string name;                     // product_name, else pci.ids, else "GPU [1002:73bf]"
+    unsigned long long vramBytes = 0;
+    int busyPercent = -1;
+    float temperatureC = -1.0f;
+    float clockMHz = -1.0f;
+};
+
+// connected outputs under <root>, sorted by name
+vector<DrmOutput> drm_connected_outputs(const string& root = "/sys/class/drm");
+
+// refresh rate of the EDID's first detailed timing (the native mode), 0 if unknown
+int drm_edid_refresh_rate(const unsigned char* edid, size_t size);
+
+// PCI GPUs under <root>, sorted by card; <module_root> holds the driver
+// versions (/sys/module/<driver>/version)
+vector<DrmGpu> drm_gpu_cards(const string& root = "/sys/class/drm", const string& module_root = "/sys/module");
+
+// current clock in an amdgpu pp_dpm_* table ("1: 2100Mhz *"), -1 if none is marked
+float drm_dpm_current_mhz(const string& table);
+
+// "Navi 21 [Radeon RX 6800/6800 XT / 6900 XT]" from the pci.ids database,
+// "" if the file or the device isn't there
+string drm_pci_device_name(unsigned vendorId, unsigned deviceId, const char* ids_path = nullptr);
+
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include "FactStore.h"   // NetSnapshot
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                  LinuxNetlink helpers
+ ---------------------------------------------------------
+
+  Everything the network sections need on Linux comes from
+  the kernel over one NETLINK_ROUTE socket:
+
+     RTM_GETLINK   name, MAC, operstate, loopback flag
+     RTM_GETADDR   every IPv4 / IPv6 address + prefix length
+     RTM_GETROUTE  default routes -> the "active" interface
+
+  Three dumps, a handful of syscalls, no getifaddrs() and no
+  child processes (ip / ifconfig / iw). The only extra reads
+  are /sys/class/net/<if>/speed and .../wireless for
+  interfaces that are up, since netlink doesn't carry those.
+
+     NetSnapshot net = netlink_snapshot();
+     const NetInterface* nic = net.active();
+
+  Callers normally go through FactStore::network(), which
+  runs the dump once per run. Nothing here exists on Windows.
+*/
+#ifndef _WIN32
+
+// all interfaces, addresses and the default route interface
+NetSnapshot netlink_snapshot();
+
+// SSID the wireless interface <ifindex> is connected to (nl80211), "" if none
+string netlink_wifi_ssid(int ifindex);
+
+#endif
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                  LinuxSysfs helpers
+ ---------------------------------------------------------
+
+  The Linux backends read a lot of tiny files from /proc and
+  /sys (one number or one word each). These helpers do that
+  with a single open + read into a caller provided (stack)
+  buffer - no iostreams, no allocations, no child processes.
+
+     char buf[64];
+     if (sysfs_read("/sys/.../scaling_cur_freq", buf, sizeof(buf)) > 0) ...
+
+  Trailing newlines are stripped and the buffer is always
+  NUL terminated. Nothing here exists on Windows.
+*/
+#ifndef _WIN32
+
+// bytes read (without the trailing newline), -1 if the file can't be read
+long sysfs_read(const char* path, char* buf, size_t size);
+
+// first integer in the file, fallback if missing / unreadable
+long long sysfs_read_long(const char* path, long long fallback = -1);
+
+// whole (small) file as a string, "" if missing
+string sysfs_read_string(const char* path);
+
+// whole file of any size (mountinfo, binary blobs), "" if missing
+string sysfs_read_all(const char* path);
+
+// number of CPUs in a kernel cpu list such as "0-3,8-11" (0 on bad input)
+int sysfs_count_cpu_list(const char* list);
+
+// first CPU of a kernel cpu list ("4-7" -> 4), -1 on bad input
+int sysfs_first_cpu(const char* list);
+
+#endif
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                    MappedFile Class
+ ---------------------------------------------------------
+
+  A read-only view of a whole file (MapViewOfFile / mmap),
+  for the precompiled files BinaryFetch keeps beside their
+  sources (BinaryFetch_Config.bin, BinaryARTS.idx). Only the
+  pages that are actually read get loaded.
+
+     MappedFile f;
+     if (f.open(path)) use(f.data(), f.size());
+
+  stamp() and replace() are the two other halves of that
+  pattern: telling whether the source changed since the
+  file was built, and writing a new one without a reader
+  ever seeing half of it.
+*/
+class MappedFile {
+public:
+    MappedFile() : view(nullptr), length(0) {}
+    ~MappedFile() { close(); }
+
+    // false if missing, empty or not mappable
+    bool open(const string& path);
+    void close();
+
+    bool isOpen() const { return view != nullptr; }
+    const char* data() const { return view; }
+    size_t size() const { return length; }
+
+    // last write time + size of <path>; false if it doesn't exist
+    static bool stamp(const string& path, unsigned long long& time, unsigned long long& size);
+
+    // write <data> to <path>.tmp and rename it over <path>
+    static bool replace(const string& path, const char* data, size_t size);
+
+private:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* view;
+    size_t length;
+};
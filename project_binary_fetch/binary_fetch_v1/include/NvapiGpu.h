@@ -0,0 +1,30 @@
+#pragma once
+
+#include "nvapi.h"
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                     NVAPI GPU handle
+ ---------------------------------------------------------
+
+  The first NVIDIA GPU, shared by the modules that poll it
+  (PerformanceInfo, CompactPerformance) instead of each one
+  initializing NVAPI on its own:
+
+     if (NvPhysicalGpuHandle gpu = nvapiFirstGpu()) {
+         ... NvAPI_GPU_GetDynamicPstatesInfoEx(gpu, ...) ...
+     }
+
+  NVAPI is initialized on the first call and that reference
+  is kept for the whole process, so --watch ticks reuse the
+  handle. NvAPI_Unload is reference counted: the other
+  modules' Initialize / Unload pairs don't tear it down.
+
+  Call it only from a section on the "gpu" lane (see
+  CollectorScheduler), like every other NVAPI user: the
+  first call is the one that initializes the library.
+
+  Returns null without nvapi64.dll or an NVIDIA GPU.
+*/
+NvPhysicalGpuHandle nvapiFirstGpu();
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "MemoryInfo.h"   // MemoryModule
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                     SMBIOS Parser
+ ---------------------------------------------------------
+
+  RAM modules, RAM slots, BIOS and motherboard all come
+  from the firmware's SMBIOS table. MemoryInfo, CompactMemory,
+  SystemInfo and CompactSystem used to ask for it separately
+  (two WMI queries, registry reads...).
+
+  This parser walks the raw structure table ONCE and fills
+  everything at the same time:
+
+     type 0   BIOS            vendor, version, release date
+     type 2   Base board      manufacturer, product
+     type 16  Memory array    number of slots
+     type 17  Memory device   capacity, type, speed (+ used slots)
+
+  The parse functions are pure: bytes in, SMBIOSInfo out, no
+  I/O. A captured table blob (Windows 'RSMB' dump, Linux
+  /sys/firmware/dmi/tables/DMI) can be fed to them directly.
+
+     const SMBIOSInfo& info = smbios_system();   // read + parse once per run
+
+  Malformed tables never crash the parser: walking stops at
+  the first structure that doesn't fit in the buffer.
+*/
+
+struct SMBIOSInfo {
+    bool valid = false;              // at least one structure was parsed
+
+    int majorVersion = 0;            // from the entry point / RSMB header, 0 if unknown
+    int minorVersion = 0;
+
+    string biosVendor;               // "" when the table doesn't say
+    string biosVersion;
+    string biosDate;
+    string boardManufacturer;
+    string boardModel;
+
+    int slotsTotal = 0;              // sum of "system memory" arrays
+    int slotsUsed = 0;               // populated memory devices
+    vector<MemoryModule> modules;    // one per populated device, MemoryInfo format
+};
+
+// Table location described by an SMBIOS entry point ("_SM_" or "_SM3_")
+struct SMBIOSEntryPoint {
+    int majorVersion = 0;
+    int minorVersion = 0;
+    unsigned long long tableAddress = 0;
+    size_t tableLength = 0;          // exact (2.x) or maximum (3.x) size
+};
+
+// Parse a 32-bit (_SM_) or 64-bit (_SM3_) entry point; false if neither
+bool smbios_parse_entry_point(const unsigned char* data, size_t size, SMBIOSEntryPoint& out);
+
+// Parse a bare structure table (the Linux DMI file, or RSMB minus its header)
+SMBIOSInfo smbios_parse_table(const unsigned char* table, size_t size, int major = 0, int minor = 0);
+
+// Parse the buffer returned by GetSystemFirmwareTable('RSMB', ...):
+// an 8 byte RawSMBIOSData header followed by the structure table
+SMBIOSInfo smbios_parse_rsmb(const unsigned char* data, size_t size);
+
+// Table of this machine, read and parsed on first use (thread-safe).
+// Linux needs root for the DMI file; without it valid stays false.
+const SMBIOSInfo& smbios_system();
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <functional>
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                   StaticCache Class
+ ---------------------------------------------------------
+
+  Hardware facts that can't change while the machine is up
+  (CPU brand, caches, sockets, BIOS, board, RAM modules, OS
+  install date, GPU adapters) used to be queried on every
+  run, mostly through WMI.
+
+  StaticCache keeps them on disk in BinaryFetch_Cache.json,
+  next to the config file. The file remembers:
+    - the boot identifier it was written under
+    - a hardware fingerprint (cheap to compute: CPU signature,
+      thread count, installed RAM, SMBIOS table hash)
+  If either one differs at load(), the file is ignored and
+  every fact is probed again, so after a reboot or a
+  hardware change nothing stale is ever shown.
+
+     string brand = StaticCache::instance().text("cpu.brand", read_brand);
+
+  Only successful probes are stored: empty strings, values
+  <= 0 and empty lists are returned but not cached, so a
+  failed WMI call is retried on the next run.
+*/
+class StaticCache {
+public:
+    using Record = map<string, string>;
+
+    static StaticCache& instance();
+
+    // read <directory>/BinaryFetch_Cache.json and validate it;
+    // reuse = false starts cold but still lets save() rewrite the file
+    void load(const string& directory, bool reuse = true);
+
+    // write the file back if a probe added something new
+    void save();
+
+    // the file was valid: static facts come from disk this run
+    bool isWarm() const { return warm; }
+
+    string text(const string& key, const function<string()>& probe);
+    int number(const string& key, const function<int()>& probe);
+    vector<Record> records(const string& key, const function<vector<Record>()>& probe);
+
+    struct State;                  // parsed file (StaticCache.cpp)
+
+private:
+    StaticCache();
+    ~StaticCache();
+    StaticCache(const StaticCache&) = delete;
+    StaticCache& operator=(const StaticCache&) = delete;
+
+    State* state;
+    mutex m;
+    string path;                   // empty until load()
+    bool warm;
+    bool dirty;
+};
@@ -3,6 +3,9 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <map>
+#include <chrono>
+#include "DiskBenchmark.h"
 using namespace std;
 
 struct storage_data {
@@ -18,15 +21,73 @@ struct storage_data {
     string write_speed;
     string predicted_read_speed;
     string predicted_write_speed;
+    DiskBenchmarkReport benchmark;   // of the physical device behind the volume
+    long long benchmark_age = -1;    // seconds since a cached benchmark ran, -1 = ran now
+};
+
+/*
+  Rows go through four stages (StorageInfoPipeline.cpp):
+
+     enumerate   drive letters / mounts             one call
+     stat        used / total, filesystem           per volume  } <concurrency>
+     classify    SSD / HDD / USB, physical disk     per volume  } threads
+     benchmark   DiskBenchmarkBatch, per disk       <parallelDevices> disks
+
+  A row is handed to <sized> as soon as it is stat'ed and
+  classified (and so is every row before it), long before
+  any speed test ends; <measured> gets it again, speeds
+  filled in, once its disk is done. Both see the rows in
+  drive / mount order.
+*/
+
+// one volume on its way through the stages; the platform file fills it
+struct storage_volume {
+    string path;                     // "C:\", "/home"
+    string fs_type;                  // Linux: from mountinfo
+    unsigned major = 0;              // Linux: device numbers
+    unsigned minor = 0;
+    bool shown = false;              // stat worked and the volume is big enough
+    storage_data row;
+    string device;                   // physical disk, "" = nothing to measure
+    string node;                     // device to read directly, "" if unknown
+    string identity;                 // BenchmarkCache key of the disk
+    vector<string> folders;          // scratch file / large file folders
 };
 
 class StorageInfo {
 public:
     vector<storage_data> get_all_storage_info();
 
-    // NEW: Process disks one-by-one with callback
+    // rows with everything filled in, one by one
     void process_storage_info(function<void(const storage_data&)> callback);
 
+    // the cheap part of every row first, the speeds as they come in
+    void process_storage_info(function<void(const storage_data&)> sized, function<void(const storage_data&)> measured);
+
+    // queue depth / durations of the speed test (DiskBenchmark.h)
+    void set_benchmark_options(const BenchmarkOptions& options) { benchmark_options = options; }
+
+    // threads for the stat and classify stages
+    void set_concurrency(unsigned threads) { concurrency = threads > 0 ? threads : 1; }
+
 private:
     string get_storage_type(const string& drive_letter, const string& root_path, bool is_external);
+
+    // -------- stages (StorageInfo.cpp / StorageInfoLinux.cpp) --------
+    vector<storage_volume> enumerate_volumes();
+    void stat_volume(storage_volume& volume);        // sets shown
+    void classify_volume(storage_volume& volume);    // shown volumes only
+
+    unsigned concurrency = 4;
+
+    // Linux: the one time limit every statvfs() of the stat stage shares,
+    // set by enumerate_volumes() (hung mounts don't add up)
+    chrono::steady_clock::time_point stat_deadline;
+
+    // every physical device is benchmarked once, on the first of its
+    // volumes that takes a scratch file; the others reuse the result.
+    // Devices found in BenchmarkCache (by serial / WWN) aren't tested
+    BenchmarkOptions benchmark_options;
+    map<string, DiskBenchmarkReport> device_benchmarks;
+    map<string, long long> device_ages;        // cached ones: age when loaded
 };
\ No newline at end of file
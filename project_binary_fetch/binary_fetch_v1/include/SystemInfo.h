@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <vector>
+#include "SMBIOSParser.h"
 using namespace std;
 class SystemInfo {
 public:
@@ -15,4 +16,6 @@ public:
 
 private:
     string read_registry_value(const std::string& subkey, const std::string& valueName);
+    // cached; SMBIOS field first, registry value as fallback
+    string read_bios_value(const std::string& key, string SMBIOSInfo::* field, const std::string& valueName);
 };
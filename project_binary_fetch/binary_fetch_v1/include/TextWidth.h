@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                    TextWidth engine
+ ---------------------------------------------------------
+
+  How many terminal columns a UTF-8 string takes, which is
+  what every alignment decision (art padding, info columns)
+  is based on.
+
+  One pass over the bytes, no copies:
+
+     ESC [ ... final    CSI (colors)         -> 0 columns, skipped inline
+     ESC ] ... BEL/ST   OSC (titles, links)  -> 0 columns, skipped inline
+     printable ASCII                         -> 1 column, 16/32 bytes at a
+                                                time with SSE2 / AVX2
+     other code points                       -> Unicode width tables
+
+  The tables come from the Unicode 14.0 character database:
+  combining marks / format characters (Mn, Me, Cf) are 0
+  wide, East Asian Wide + Fullwidth (which covers every
+  emoji with emoji presentation) are 2 wide, the rest 1.
+  BMP blocks that are entirely 1 or 2 wide (Braille, Hangul,
+  CJK ideographs...) are answered by a 256 entry index built
+  at compile time, without searching.
+
+     size_t cols = utf8_display_width(line);
+
+  Malformed UTF-8 never throws: each bad byte counts as one
+  column (a replacement character), like terminals draw it.
+*/
+
+// columns of one code point: 0 (controls, combining marks), 1 or 2
+int codepoint_width(char32_t cp);
+
+// columns of a UTF-8 string, ANSI / OSC escape sequences excluded
+size_t utf8_display_width(const char* s, size_t n);
+size_t utf8_display_width(const string& s);
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <chrono>
+using namespace std;
+
+/*
+ ---------------------------------------------------------
+                UtilizationSampler Class
+ ---------------------------------------------------------
+
+  Usage percentages only make sense over a time window, so
+  every module used to open its own counter, sleep, and
+  sample again (5 sleeps per run in total).
+
+  The sampler is shared by the whole process instead:
+    - begin()  takes ONE baseline (main calls it right after
+               the config is loaded)
+    - the first reader takes ONE closing sample, waiting
+      only for whatever is left of the interval
+    - every later reader gets the same numbers for free
+
+  Windows : PDH (processor, GPU engine, physical disk)
+  Linux   : /proc/stat, /proc/diskstats, amdgpu busy percent
+
+  Readers never fail hard: unavailable values come back as
+  -1 (GPU / disk) or 0 (CPU), like the old per-module code.
+
+  Watch mode (--watch) calls nextWindow() once per tick:
+  the closing sample of the last window becomes the next
+  baseline, so the PDH query / procfs files stay open for
+  the whole session and no tick waits for a new baseline.
+*/
+class UtilizationSampler {
+public:
+    static UtilizationSampler& instance();
+
+    // take the baseline sample; intervalMs is the window length
+    void begin(unsigned intervalMs = 500);
+
+    unsigned getIntervalMs() const { return intervalMs; }
+
+    double cpuPercent();                 // whole CPU, 0-100
+    vector<double> perCorePercent();     // one entry per logical processor
+    double gpuPercent();                 // 3D engine busy, -1 if unknown
+    double diskPercent();                // physical disk busy time, -1 if unknown
+
+    // start a new window where the last one was closed (no-op while the
+    // current window hasn't been read yet)
+    void nextWindow();
+
+    struct Platform;                     // PDH query / procfs snapshot (UtilizationSampler.cpp)
+
+private:
+    UtilizationSampler();
+    ~UtilizationSampler();
+    UtilizationSampler(const UtilizationSampler&) = delete;
+    UtilizationSampler& operator=(const UtilizationSampler&) = delete;
+
+    Platform* platform;
+
+    mutex m;
+    bool started;
+    bool closed;
+    unsigned intervalMs;
+    chrono::steady_clock::time_point baselineAt;
+    chrono::steady_clock::time_point closedAt;
+
+    // results of the window
+    double cpu;
+    vector<double> cores;
+    double gpu;
+    double disk;
+
+    void beginLocked(unsigned interval);
+    void closeLocked();                  // closing sample (once), caller holds m
+};
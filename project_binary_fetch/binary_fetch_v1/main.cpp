@@ -12,6 +12,16 @@
 #include <fstream>        // File stream operations (reading/writing files) 
 #include <string>         // Standard string class and methods 
 #include <regex>          // Regular expressions for pattern matching 
+#include <cstdlib>        // _exit (leave without unwinding when a collector hangs) 
+#include <cctype>         // isdigit (optional --watch interval) 
+#include <chrono>         // steady_clock (--watch tick deadlines) 
+
+// The front end is Windows only (WMI, NVAPI, Core Audio sections). On Linux
+// the collectors with a Linux backend build as a library: see CMakeLists.txt
+#ifndef _WIN32
+#error "main.cpp needs Windows - on Linux build the collector library (CMakeLists.txt)"
+#endif
+
 #include <windows.h>      // Core Windows API functions (handles, processes) 
 #include <shlobj.h>       // Shell object functions (folder paths, UI) 
 #include <direct.h>       // Directory and file handling functions (_mkdir, _chdir) 
@@ -20,38 +30,48 @@
 
 
 // ASCII Art functionality
-#include "include\AsciiArt.h" // main.cpp (AsciiArt separated into header and implementation files)
+#include "include/AsciiArt.h" // main.cpp (AsciiArt separated into header and implementation files)
 
 
 // ------------------ Full System Info Modules ------------------
-#include "include\OSInfo.h"             // OS name, version, build info
-#include "include\CPUInfo.h"            // CPU model, threads, cores, base/boost clocks
-#include "include\MemoryInfo.h"         // RAM capacity, usage, speed, type
-#include "include\GPUInfo.h"            // GPU model and basic information
-#include "include\StorageInfo.h"        // Disk drives, partitions, used/free space
-#include "include\NetworkInfo.h"        // Active network adapters, IP, speeds
-#include "include\DetailedGPUInfo.h"    // Deep GPU details: VRAM usage, clocks, temps
-#include "include\PerformanceInfo.h"    // CPU load, RAM load, GPU usage
-#include "include\UserInfo.h"           // Username, PC name, domain
-#include "include\SystemInfo.h"         // Motherboard, BIOS, system manufacturer
-#include "include\DisplayInfo.h"        // Monitor resolution, refresh rate, scaling
-#include "include\ExtraInfo.h"          // Additional misc system data
+#include "include/OSInfo.h"             // OS name, version, build info
+#include "include/CPUInfo.h"            // CPU model, threads, cores, base/boost clocks
+#include "include/MemoryInfo.h"         // RAM capacity, usage, speed, type
+#include "include/GPUInfo.h"            // GPU model and basic information
+#include "include/StorageInfo.h"        // Disk drives, partitions, used/free space
+#include "include/NetworkInfo.h"        // Active network adapters, IP, speeds
+#include "include/DetailedGPUInfo.h"    // Deep GPU details: VRAM usage, clocks, temps
+#include "include/PerformanceInfo.h"    // CPU load, RAM load, GPU usage
+#include "include/UserInfo.h"           // Username, PC name, domain
+#include "include/SystemInfo.h"         // Motherboard, BIOS, system manufacturer
+#include "include/DisplayInfo.h"        // Monitor resolution, refresh rate, scaling
+#include "include/ExtraInfo.h"          // Additional misc system data
 
 
 
 // ------------------ Compact Mode Output Modules ------------------
-#include "include\CompactAudio.h"       // Audio device summary for compact mode
-#include "include\CompactOS.h"          // Lightweight OS summary
-#include "include\CompactCPU.h"         // Lightweight CPU summary
-#include "include\CompactMemory.h"      // Lightweight RAM summary
-#include "include\CompactScreen.h"      // Lightweight screen resolution summary
-#include "include\CompactSystem.h"      // Lightweight motherboard/system summary
-#include "include\CompactGPU.h"         // Lightweight GPU summary
-#include "include\CompactPerformance.h" // Lightweight performance stats
-#include "include\CompactUser.h"        // Lightweight user info
-#include "include\CompactNetwork.h"     // Lightweight network info
-#include "include\compact_disk_info.h"  // Lightweight storage/disk info (compact mode)
-#include "include\TimeInfo.h"           //returns current time info (second, minute, hour, day, week, month, year, leap year, etc)
+#include "include/CompactAudio.h"       // Audio device summary for compact mode
+#include "include/CompactOS.h"          // Lightweight OS summary
+#include "include/CompactCPU.h"         // Lightweight CPU summary
+#include "include/CompactMemory.h"      // Lightweight RAM summary
+#include "include/CompactScreen.h"      // Lightweight screen resolution summary
+#include "include/CompactSystem.h"      // Lightweight motherboard/system summary
+#include "include/CompactGPU.h"         // Lightweight GPU summary
+#include "include/CompactPerformance.h" // Lightweight performance stats
+#include "include/CompactUser.h"        // Lightweight user info
+#include "include/CompactNetwork.h"     // Lightweight network info
+#include "include/compact_disk_info.h"  // Lightweight storage/disk info (compact mode)
+#include "include/TimeInfo.h"           //returns current time info (second, minute, hour, day, week, month, year, leap year, etc)
+#include "include/CollectorScheduler.h"  // runs the sections in parallel, prints them in order
+#include "include/UtilizationSampler.h"  // one shared CPU/GPU/disk usage window per run
+#include "include/LazyModule.h"          // modules are only built when a section needs them
+#include "include/FactStore.h"           // facts shared between modules (uptime, GPUs, SSID), probed once
+#include "include/StaticCache.h"         // static hardware facts kept on disk between runs
+#include "include/BenchmarkCache.h"      // disk / network speed test results kept per device
+#include "include/ConfigIndex.h"         // config flattened once, looked up by hash
+#include "include/LineTemplate.h"        // section lines laid out by config templates
+#include "include/ArtLibrary.h"          // BinaryARTS.txt indexed, one art picked by name / tag
+#include "include/DiskBenchmark.h"       // queued, unbuffered disk speed test (detailed_storage)
 
 
 
@@ -94,9 +114,16 @@ it is a sign that the logic should be moved into a new module.
 
 //Initialize Global Variables (if any) here ------ (start)
 
+// --watch: set by Ctrl+C / closing the console, ends the watch loop
+static HANDLE watchStop = NULL;
+static BOOL WINAPI onWatchStop(DWORD) {
+    SetEvent(watchStop);
+    return TRUE; // handled: main() still restores the terminal and saves the caches
+}
+
 //Initialize Global Variables (if any) here ------ (end)
 
-int main(){
+int main(int argc, char* argv[]){
 
     // Initialize COM 
     /*
@@ -128,17 +155,64 @@ int main(){
 
 
     
-    // ========== SIMPLIFIED ASCII ART LOADING ==========
-        // Just call loadFromFile() - it handles everything automatically!
-        // - Checks C:\Users\<User>\AppData\BinaryFetch\BinaryArt.txt
-        // - If missing, copies from Default_Ascii_Art.txt and creates it
-        // - User can modify their art anytime in AppData folder
-
 	SetConsoleOutputCP(CP_UTF8); // UTF-8 output on Windows console (for emoji printing)
-    AsciiArt art;
-    if (!art.loadFromFile()) {
-        cout << "Warning: ASCII art could not be loaded. Continuing without art.\n";
-        // Program continues even if art fails to load
+
+    // ========== COMMAND LINE ==========
+    // --budget <ms> : hard upper bound for the whole run. Sections that are not
+    //                 done by then are printed as a placeholder (see scheduler).
+    // --stats        : after the output, show how often each shared fact was
+    //                  probed (miss) vs. served from the FactStore (hit), and
+    //                  how many config lookups the sections made.
+    // --refresh-cache: ignore BinaryFetch_Cache.json and probe the static
+    //                  hardware facts again, and parse the config instead of
+    //                  mapping BinaryFetch_Config.bin, and index BinaryARTS.txt
+    //                  again (all of them are rewritten).
+    // --buffered / --live : override "output.mode" from the config (see LivePrinter).
+    // --art <name|auto>: show an art from BinaryARTS.txt instead of BinaryArt.txt
+    //                  (overrides "art_library.select", see ART LOADING).
+    // --watch [ms]   : stay on screen and refresh every <ms> (default
+    //                  "watch.interval_ms", 100 = 10 Hz at most), see WATCH MODE.
+    // --rebench      : run the disk / network speed tests even if
+    //                  BinaryFetch_Bench.json holds fresh results for them.
+    unsigned budgetMs = 0; // 0 = no limit
+    bool showStats = false;
+    bool refreshCache = false;
+    bool rebench = false;
+    string outputModeArg; // "" = take it from the config
+    string artArg;        // "" = take it from the config
+    bool watch = false;
+    unsigned watchMs = 0; // 0 = take it from the config
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--budget" && i + 1 < argc) {
+            try {
+                budgetMs = static_cast<unsigned>(stoul(argv[++i]));
+            }
+            catch (...) {
+                cout << "Warning: --budget expects a number of milliseconds. Ignoring it." << endl;
+            }
+        }
+        else if (arg == "--stats") {
+            showStats = true;
+        }
+        else if (arg == "--refresh-cache") {
+            refreshCache = true;
+        }
+        else if (arg == "--rebench") {
+            rebench = true;
+        }
+        else if (arg == "--buffered" || arg == "--live") {
+            outputModeArg = arg.substr(2);
+        }
+        else if (arg == "--art" && i + 1 < argc) {
+            artArg = argv[++i];
+        }
+        else if (arg == "--watch") {
+            watch = true;
+            if (i + 1 < argc && isdigit(static_cast<unsigned char>(argv[i + 1][0]))) {
+                watchMs = static_cast<unsigned>(strtoul(argv[++i], nullptr, 10));
+            }
+        }
     }
 
     // ========== AUTO CONFIG FILE SETUP ==========
@@ -187,31 +261,10 @@ int main(){
         }
     } 
 
-    // ========== CONFIG LOADING ==========
-    json config;
-    bool config_loaded = false; // must be false by default
-
-    ifstream config_file(configPath);
-    if (config_file.is_open()) {
-        try {
-            config = json::parse(config_file);
-            config_loaded = true; // if the json is successfully loaded
-        }
-        catch (const exception& e) {
-            cout << "Warning: Failed to parse config file. Using hardcoded defaults." << endl;
-
-            // provide warning msg if the json parsing fails
-        }
-        config_file.close(); // close the file after reading 
-    }
-    else {
-        cout << "Warning: Could not open config file: " << configPath << endl;
-    }
-
 	// Color map (for ANSI escape codes) 
     // for beginners, we're simply assign colors like how we 
     // assin vaules in variables 
-    map<string, string> colors = {
+    const map<string, string> colors = {
         {"red", "\033[31m"}, {"green", "\033[32m"}, {"yellow", "\033[33m"},
         {"blue", "\033[34m"}, {"magenta", "\033[35m"}, {"cyan", "\033[36m"},
         {"white", "\033[37m"}, {"bright_red", "\033[91m"}, {"bright_green", "\033[92m"},
@@ -220,39 +273,127 @@ int main(){
         {"bright_white", "\033[97m"}, {"reset", "\033[0m"}
     };
 
+    // ========== CONFIG LOADING ==========
+    // The config is flattened into one hash table (see ConfigIndex.h) and
+    // kept beside the JSON as BinaryFetch_Config.bin. While the JSON hasn't
+    // changed that file is mapped as is and nothing gets parsed; after an
+    // edit (or with --refresh-cache) it is parsed, compiled and rewritten.
+    // Sections run on the collector worker pool (see CollectorScheduler),
+    // so from here on the config and the color table are read-only.
+    ConfigIndex cfg(colors);
+    bool config_loaded = cfg.load(configPath, !refreshCache);
+
+    if (!config_loaded) {
+        ifstream config_file(configPath, ios::binary);
+        if (config_file.is_open()) {
+            string config_text((istreambuf_iterator<char>(config_file)), istreambuf_iterator<char>());
+            config_file.close(); // close the file after reading 
+            try {
+                cfg.compile(json::parse(config_text), config_text);
+                config_loaded = true; // if the json is successfully loaded
+                cfg.save();
+            }
+            catch (const exception& e) {
+                cout << "Warning: Failed to parse config file. Using hardcoded defaults." << endl;
+
+                // provide warning msg if the json parsing fails
+            }
+        }
+        else {
+            cout << "Warning: Could not open config file: " << configPath << endl;
+        }
+    }
+
+    // ========== ASCII ART LOADING ==========
+    // "art_library.select" (or --art) picks one art out of BinaryARTS.txt:
+    // a name or tag from its "@art" lines, a number (3 = third art), or
+    // "auto" for the first art tagged with this OS / distro / CPU vendor.
+    // The collection is indexed once into BinaryARTS.idx (see ArtLibrary.h),
+    // so only the chosen art is read. Nothing selected, or nothing found:
+    // loadFromFile() as always
+    // - Checks C:\Users\Public\BinaryFetch\BinaryArt.txt
+    // - If missing, copies the default art from the EXE and creates it
+    // - User can modify their art anytime in that folder
+    AsciiArt art;
+    ArtLibrary artLibrary;
+    int libraryArt = -1;
+    string artSelect = !artArg.empty() ? artArg : cfg.text({ "art_library", "select" }, "");
+    if (!artSelect.empty()) {
+        string libraryPath = cfg.text({ "art_library", "file" }, "");
+        if (libraryPath.empty()) {
+            libraryPath = configDir + "\\BinaryARTS.txt";
+            if (GetFileAttributesA(libraryPath.c_str()) == INVALID_FILE_ATTRIBUTES) libraryPath = "BinaryARTS.txt";
+        }
+
+        if (!artLibrary.open(libraryPath, !refreshCache)) {
+            cout << "Warning: Could not open art library: " << libraryPath << endl;
+        }
+        else {
+            libraryArt = artSelect == "auto" ? artLibrary.findForSystem() : artLibrary.find(artSelect);
+            if (libraryArt < 0 && artSelect != "auto") {
+                cout << "Warning: No art named \"" << artSelect << "\" in " << libraryPath << "." << endl;
+            }
+        }
+    }
+
+    if (libraryArt < 0 || !art.loadFromLibrary(artLibrary, libraryArt)) {
+        libraryArt = -1;
+        if (!art.loadFromFile()) {
+            cout << "Warning: ASCII art could not be loaded. Continuing without art.\n";
+            // Program continues even if art fails to load
+        }
+    }
+
+    // Start the shared usage sampling window as early as possible: CPU / GPU /
+    // disk usage need two samples, and by the time a section asks for them most
+    // of the interval has already passed while the other collectors ran.
+    unsigned samplerIntervalMs = static_cast<unsigned>(cfg.number({ "sampler", "interval_ms" }, 500));
+    if (watch) {
+        if (watchMs == 0) watchMs = static_cast<unsigned>(cfg.number({ "watch", "interval_ms" }, 1000));
+        if (watchMs < 100) watchMs = 100;
+        // every tick reads the window since the last one; a longer first
+        // window would only delay the first frame
+        if (samplerIntervalMs > watchMs) samplerIntervalMs = watchMs;
+    }
+    UtilizationSampler::instance().begin(samplerIntervalMs);
+
+    // Static hardware facts (CPU brand, BIOS, RAM modules, GPUs...) come from
+    // BinaryFetch_Cache.json when it was written during this boot on this
+    // hardware; otherwise they are probed and the file is refreshed at exit.
+    bool staticCacheEnabled = cfg.flag({ "static_cache", "enabled" });
+    if (staticCacheEnabled) {
+        StaticCache::instance().load(configDir, !refreshCache);
+    }
+
+    // Speed test results survive reboots: BinaryFetch_Bench.json keeps them per
+    // drive (serial) and per network link until they are max_age_hours old.
+    bool benchCacheEnabled = cfg.flag({ "benchmark_cache", "enabled" });
+    if (benchCacheEnabled) {
+        double maxAgeHours = cfg.number({ "benchmark_cache", "max_age_hours" }, 168);
+        BenchmarkCache::instance().load(configDir, !rebench, static_cast<long long>(maxAgeHours * 3600.0));
+    }
+
     // Helper functions 
     // here, we've assigned the default color as white 
-    auto getColor = [&](const string& section, const string& key, const string& defaultColor = "white") -> string 
+    auto getColor = [&](ConfigKey section, ConfigKey key, ConfigKey defaultColor = "white") -> const string&
      {
-        if (!config_loaded || !config.contains(section)) return colors[defaultColor];
-
         // First...try to get the color from the nested "colors" object
-        if (config[section].contains("colors") && config[section]["colors"].contains(key)) 
-        {
-            string colorName = config[section]["colors"][key].get<string>();
-            return colors.count(colorName) ? colors[colorName] : colors[defaultColor];
-        }
-        // next...try to get the color directly from the section
-        if (config[section].contains(key)) {
-            string colorName = config[section][key].get<string>();
-            return colors.count(colorName) ? colors[colorName] : colors[defaultColor];
-        }
+        if (cfg.has({ section, "colors", key })) return cfg.color({ section, "colors", key }, defaultColor);
 
-        return colors[defaultColor];
+        // next...try to get the color directly from the section
+        return cfg.color({ section, key }, defaultColor);
      };
 
     // check for each section, is it enabled or not (Aka Core-Module)
     // Example of core-module: CPU,GPU,OS,Netwrok....bla bla bla
-    auto isEnabled = [&](const string& section) -> bool {
-        if (!config_loaded || !config.contains(section)) return true;
-        return config[section].value("enabled", true);
+    auto isEnabled = [&](ConfigKey section) -> bool {
+        return cfg.flag({ section, "enabled" });
         };
     // check for each subsection inside a section,
     // is it enabled or not (Aka sub-module)
 	// example of sub-module: CPU base speed, CPU cores, CPU threads...bla bla bla
-    auto isSubEnabled = [&](const string& section, const string& key) -> bool {
-        if (!config_loaded || !config.contains(section)) return true;
-        return config[section].value(key, true);
+    auto isSubEnabled = [&](ConfigKey section, ConfigKey key) -> bool {
+        return cfg.flag({ section, key });
         };
     // checks whether a specific section inside a module is enabled or not
      // example:
@@ -260,15 +401,11 @@ int main(){
      // section -> "ipv4"
      //
      // logic:
-     // - if config is not loaded, allow it (default ON)
-     // - if the module does not exist in config, allow it
-     // - if the module has no "sections" block, allow all sections
-     // - otherwise, read the value from: config[module]["sections"][section]
-     // - if the section key is missing, default to true...
-    auto isSectionEnabled = [&](const string& module, const string& section) -> bool {
-        if (!config_loaded || !config.contains(module)) return true;
-        if (!config[module].contains("sections")) return true;
-        return config[module]["sections"].value(section, true);
+     // - read the value at: module.sections.section
+     // - if config is not loaded, or anything on that path is missing,
+     //   allow it (default ON)
+    auto isSectionEnabled = [&](ConfigKey module, ConfigKey section) -> bool {
+        return cfg.flag({ module, "sections", section });
         };
      
    // checks whether a deeply nested key inside a module + section is enabled
@@ -278,53 +415,255 @@ int main(){
      // key     -> "public_ip"
      //
    // logic:
-     // - if config is not loaded, allow it (default ON)
-     // - if the module does not exist, allow it
-     // - if the section does not exist inside the module, allow it
-     // - otherwise, read the value from: config[module][section][key]
-     // - if the key is missing, default to true
-    auto isNestedEnabled = [&](const string& module, const string& section, const string& key) -> bool {
-        if (!config_loaded || !config.contains(module)) return true;
-        if (!config[module].contains(section)) return true;
-        return config[module][section].value(key, true);
+     // - read the value at: module.section.key
+     // - if config is not loaded, or anything on that path is missing,
+     //   allow it (default ON)
+    auto isNestedEnabled = [&](ConfigKey module, ConfigKey section, ConfigKey key) -> bool {
+        return cfg.flag({ module, section, key });
         };
 
-    string r = colors["reset"];
+    string r = colors.at("reset");
+
+    // ========== LINE TEMPLATES ==========
+    // The one-line compact sections are laid out by a template (see
+    // LineTemplate.h): the section's "template" key in the config, else the
+    // built-in one below, which prints exactly what the section always did.
+    // All of them are compiled here, once; the sections only fill in values.
+    static const char* const COMPACT_OS_LINE =
+        u8"{if:show_emoji}{color:emoji_color}🚀 {reset}{end}"
+        "{color:OS}OS{reset}{color:OS_:}: {reset}"
+        "{if:show_name}{color:name_color}{name}{reset} {end}"
+        "{if:show_build}{color:build_color}{build}{reset}{end}"
+        "{if:show_arch}{color:(} ({reset}{color:arch_color}{arch}{reset}{color:)}){reset}{end}"
+        "{if:show_uptime}{color:(} ({reset}{color:uptime_label_color}uptime: {reset}"
+        "{color:uptime_value_color}{uptime}{reset}{color:)}){reset}{end}";
+
+    static const char* const COMPACT_CPU_LINE =
+        u8"{if:show_emoji}{color:emoji_color}🧠 {reset}{end}"
+        "{color:CPU}CPU{reset}{color:CPU_:}: {reset}"
+        "{if:show_name}{color:name_color}{name}{reset}{end}"
+        "{if:show_cores|show_threads}{color:(} ({reset}"
+        "{if:show_cores}{color:core_color}{cores}{reset}{color:text_color}C{reset}{end}"
+        "{if:show_cores&show_threads}{color:separator_color}/{reset}{end}"
+        "{if:show_threads}{color:thread_color}{threads}{reset}{color:text_color}T{reset}{end}"
+        "{color:)}){reset}{end}"
+        "{if:show_clock}{color:at_symbol_color} @{reset}{color:clock_color} {clock:.2f} GHz{reset}{end}";
+
+    static const char* const COMPACT_GPU_LINE =
+        u8"{if:show_emoji}{color:emoji_color}🔥{reset} {end}"
+        "{color:GPU}GPU{reset}{color:GPU_:}: {reset}"
+        "{if:show_name}{color:name_color}{name}{reset}{end}"
+        "{if:show_usage}{color:(} ({reset}{color:usage_color}{usage}%{reset}{color:)}){reset}{end}"
+        "{if:show_vram}{color:(} ({reset}{color:vram_color}{vram} GB{reset}{color:)}){reset}{end}"
+        "{if:show_freq}{color:(} ({reset}{color:at_symbol_color}@{reset}{color:freq_color}{freq}{reset}{color:)}){reset}{end}";
+
+    static const char* const COMPACT_MEMORY_LINE =
+        u8"{if:show_emoji}{color:emoji_color}📟{reset} {end}"
+        "{color:Memory}Memory{reset}{color:Memory_:}: {reset}"
+        "{if:show_total}{color:(}({reset}{color:label_color}total: {reset}{color:total_color}{total} GB{reset}{color:)}){reset}{end}"
+        "{if:show_free} {color:(}({reset}{color:label_color}free: {reset}{color:free_color}{free} GB{reset}{color:)}){reset}{end}"
+        "{if:show_percent} {color:(}({reset}{color:percent_color}{percent}%{reset}{color:)}){reset}{end}";
+
+    static const char* const COMPACT_USER_LINE =
+        u8"{if:show_emoji}{color:emoji_color}☕{reset} {end}"
+        "{color:User}User{reset}{color:User_:}: {reset}"
+        "{if:show_username}{color:username_color}@{username}{reset}{end}"
+        "{if:show_domain} {color:(}({reset}{color:label_color}Domain: {reset}{color:domain_color}{domain}{reset}{color:)}){reset}{end}"
+        "{if:show_type} {color:(}({reset}{color:label_color}Type: {reset}{color:type_color}{type}{reset}{color:)}){reset}{end}";
+
+    static const char* const COMPACT_PERFORMANCE_LINE =
+        u8"{if:show_emoji}{color:emoji_color}🔋{reset} {end}"
+        "{color:Performance}Performance{reset}{color:Performance_:}: {reset}"
+        "{if:show_cpu}{color:(}({reset}{color:label_color}CPU: {reset}{color:cpu_color}{cpu}%{reset}{color:)}) {reset}{end}"
+        "{if:show_gpu}{color:(}({reset}{color:label_color}GPU: {reset}{color:gpu_color}{gpu}%{reset}{color:)}) {reset}{end}"
+        "{if:show_ram}{color:(}({reset}{color:label_color}RAM: {reset}{color:ram_color}{ram}%{reset}{color:)}) {reset}{end}"
+        "{if:show_disk}{color:(}({reset}{color:label_color}Disk: {reset}{color:disk_color}{disk}%{reset}{color:)}) {reset}{end}";
+
+    static const char* const COMPACT_TIME_LINE =
+        u8"{if:show_emoji}{color:emoji_color}📅{reset} {end}"
+        "{if:time_section.enabled}{color:time_section.colors.bracket}({reset}"
+        "{if:time_section.show_label}{color:time_section.colors.label}Time: {reset}{end}"
+        "{if:time_section.show_hour}{color:time_section.colors.hour}{hour}{reset}{end}"
+        "{if:time_section.show_minute}{if:time_section.show_hour}{color:time_section.colors.sep}:{reset}{end}"
+        "{color:time_section.colors.minute}{minute}{reset}{end}"
+        "{if:time_section.show_second}{if:time_section.show_hour|time_section.show_minute}{color:time_section.colors.sep}:{reset}{end}"
+        "{color:time_section.colors.second}{second}{reset}{end}"
+        "{color:time_section.colors.bracket}) {reset}{end}"
+        "{if:date_section.enabled}{color:date_section.colors.bracket}({reset}"
+        "{if:date_section.show_label}{color:date_section.colors.label}Date: {reset}{end}"
+        "{if:date_section.show_day}{color:date_section.colors.day}{day}{reset}{end}"
+        "{if:date_section.show_month_name}{if:date_section.show_day}{color:date_section.colors.sep} : {reset}{end}"
+        "{color:date_section.colors.month_name}{month_name}{reset}{end}"
+        "{if:date_section.show_month_num}{if:date_section.show_day|date_section.show_month_name} {end}"
+        "{color:date_section.colors.month_num}{month}{reset}{end}"
+        "{if:date_section.show_year}{if:date_section.show_day|date_section.show_month_name|date_section.show_month_num}"
+        "{color:date_section.colors.sep} : {reset}{end}{color:date_section.colors.year}{year}{reset}{end}"
+        "{color:date_section.colors.bracket}) {reset}{end}"
+        "{if:week_section.enabled}{color:week_section.colors.bracket}({reset}"
+        "{if:week_section.show_label}{color:week_section.colors.label}Week: {reset}{end}"
+        "{if:week_section.show_num}{color:week_section.colors.num}{week}{reset}{end}"
+        "{if:week_section.show_day_name}{if:week_section.show_num}{color:week_section.colors.sep} - {reset}{end}"
+        "{color:week_section.colors.day_name}{day_name}{reset}{end}"
+        "{color:week_section.colors.bracket}) {reset}{end}"
+        "{if:leap_section.enabled}{color:leap_section.colors.bracket}({reset}"
+        "{if:leap_section.show_label}{color:leap_section.colors.label}Leap Year: {reset}{end}"
+        "{if:leap_section.show_val}{color:leap_section.colors.val}{leap}{reset}{end}"
+        "{color:leap_section.colors.bracket}){reset}{end}";
+
+    // one line per screen
+    static const char* const COMPACT_SCREEN_LINE =
+        u8"{if:show_emoji}{color:emoji_color}📺{reset} {end}"
+        "{color:Display}Display {index}{reset}{color:Display_:}: {reset}"
+        "{if:show_name}{color:name_color}{name}{reset} {end}"
+        "{if:show_resolution}{color:(}({reset}{color:resolution_color}{width}{reset}{color:x} x {reset}"
+        "{color:resolution_color}{height}{reset}{color:)}) {reset}{end}"
+        "{if:show_scale}{color:(}({reset}{color:scale_label}Scale: {reset}{color:scale_value}{scale}%{reset}{color:)}) {reset}{end}"
+        "{if:show_upscale}{color:(}({reset}{color:upscale_label}upscale: {reset}{color:upscale_value}{upscale}{reset}{color:)}) {reset}{end}"
+        "{if:show_refresh}{color:(}({reset}{color:@}@{reset}{color:refresh_color}{refresh}Hz{reset}{color:)}){reset}{end}";
+
+    static const char* const COMPACT_NO_SCREEN_LINE =
+        "{color:Display}Display{reset}{color:Display_:}: {reset}{color:name_color}No displays detected{reset}";
+
+    static const char* const COMPACT_AUDIO_INPUT_LINE =
+        u8"{if:show_audio_input_emoji}{color:audio_output_emoji_color}🎙️{reset} {end}"
+        "{color:Audio Input}Audio Input{reset}{color:Audio_Input_:}: {reset}"
+        "{color:device_color}{device}{reset} {color:(}[{reset}{color:status_color}{status}{reset}{color:)}]{reset}";
+
+    static const char* const COMPACT_AUDIO_OUTPUT_LINE =
+        u8"{if:show_audio_output_emoji}{color:audio_input_emoji_color}🎧{reset} {end}"
+        "{color:Audio Output}Audio Output{reset}{color:Audio_Output_:}: {reset}"
+        "{color:device_color}{device}{reset} {color:(}[{reset}{color:status_color}{status}{reset}{color:)}]{reset}";
+
+    static const char* const COMPACT_NETWORK_LINE =
+        u8"{if:show_emoji}{color:emoji_color}🌐{reset} {end}"
+        "{color:Network}Network{reset}{color:Network_:}: {reset}"
+        "{if:show_name}{color:(}({reset}{color:label_color}Name: {reset}{color:name_color}{name}{reset}{color:)}) {reset}{end}"
+        "{if:show_type}{color:(}({reset}{color:label_color}Type: {reset}{color:type_color}{type}{reset}{color:)}) {reset}{end}"
+        "{if:show_ip}{color:(}({reset}{color:label_color}ip: {reset}{color:ip_color}{ip}{reset}{color:)}){reset}{end}";
+
+    // the disk lines hold one item per drive in {drives}
+    static const char* const COMPACT_DISK_USAGE_LINE =
+        u8"{if:show_disk_usage_emoji}{color:disk_usage_emoji_color}📂{reset} {end}"
+        "{color:Disk Usage}Disk Usage{reset}{color:Disk_Usage_:}: {reset}{drives}";
+
+    static const char* const COMPACT_DISK_USAGE_ITEM =
+        "{color:(}({reset}{color:letter_color}{letter}:{reset} {color:percent_color}{percent}%{reset}{color:)}) {reset}";
+
+    static const char* const COMPACT_DISK_CAPACITY_LINE =
+        u8"{if:show_disk_capacity_emoji}{color:disk_capacity_emoji_color}📊{reset} {end}"
+        "{color:Disk Cap}Disk Cap{reset}{color:Disk_Cap_:}: {reset}{drives}";
+
+    static const char* const COMPACT_DISK_CAPACITY_ITEM =
+        "{color:(}({reset}{color:letter_color}{letter}{reset}{color:separator_color}-{reset}"
+        "{color:capacity_color}{capacity}GB{reset}{color:)}){reset}";
+
+    // a broken user template is reported and replaced by the built-in one;
+    // <key> is "template" unless the section has several lines
+    auto loadLine = [&](const char* section, const char* builtIn, initializer_list<const char*> fields,
+        const char* key = "template") -> LineTemplate {
+        LineTemplate line;
+        if (!line.compile(cfg.text({ section, key }, builtIn), cfg, section, fields)) {
+            cout << "Warning: " << section << "." << key << ": " << line.error() << ". Using the built-in layout." << endl;
+            line.compile(builtIn, cfg, section, fields);
+        }
+        return line;
+    };
+
+    const LineTemplate osLine = loadLine("compact_os", COMPACT_OS_LINE, { "name", "build", "arch", "uptime" });
+    const LineTemplate cpuLine = loadLine("compact_cpu", COMPACT_CPU_LINE, { "name", "cores", "threads", "clock" });
+    const LineTemplate gpuLine = loadLine("compact_gpu", COMPACT_GPU_LINE, { "name", "usage", "vram", "freq" });
+    const LineTemplate memoryLine = loadLine("compact_memory", COMPACT_MEMORY_LINE, { "total", "free", "percent" });
+    const LineTemplate userLine = loadLine("compact_user", COMPACT_USER_LINE, { "username", "domain", "type" });
+    const LineTemplate perfLine = loadLine("compact_performance", COMPACT_PERFORMANCE_LINE, { "cpu", "gpu", "ram", "disk" });
+    const LineTemplate timeLine = loadLine("compact_time", COMPACT_TIME_LINE,
+        { "hour", "minute", "second", "day", "month_name", "month", "year", "week", "day_name", "leap" });
+    const LineTemplate screenLine = loadLine("compact_screen", COMPACT_SCREEN_LINE,
+        { "index", "name", "width", "height", "scale", "upscale", "refresh" });
+    const LineTemplate noScreenLine = loadLine("compact_screen", COMPACT_NO_SCREEN_LINE, {}, "empty_template");
+    const LineTemplate audioInputLine = loadLine("compact_audio", COMPACT_AUDIO_INPUT_LINE, { "device", "status" }, "input_template");
+    const LineTemplate audioOutputLine = loadLine("compact_audio", COMPACT_AUDIO_OUTPUT_LINE, { "device", "status" }, "output_template");
+    const LineTemplate networkLine = loadLine("compact_network", COMPACT_NETWORK_LINE, { "name", "type", "ip" });
+    const LineTemplate diskUsageLine = loadLine("compact_disk", COMPACT_DISK_USAGE_LINE, { "drives" }, "usage_template");
+    const LineTemplate diskUsageItem = loadLine("compact_disk", COMPACT_DISK_USAGE_ITEM, { "letter", "percent" }, "usage_item_template");
+    const LineTemplate diskCapacityLine = loadLine("compact_disk", COMPACT_DISK_CAPACITY_LINE, { "drives" }, "capacity_template");
+    const LineTemplate diskCapacityItem = loadLine("compact_disk", COMPACT_DISK_CAPACITY_ITEM, { "letter", "capacity" }, "capacity_item_template");
+
+    // one render buffer per section, kept across --watch ticks so a line is
+    // only allocated once (a section never runs twice at the same time)
+    string timeText, osText, cpuText, gpuText, screenText, memoryText, audioText,
+        perfText, userText, networkText, dummyNetworkText, diskText, diskDrives, diskItem;
 
 	// Anyway....this is how we're allowed to print emojis in C++ console
     // :cout << u8"😄 ❤️ 🎉 🚀 ⭐ 🐱 🍕 🎮 😭 🌈\n"; 
 
 
     // Create LivePrinter
-    LivePrinter lp(art);
-
-
-    // create objects of all classes here 
-    OSInfo os;                           
-    CPUInfo cpu;
-    MemoryInfo ram;
-    GPUInfo obj_gpu;
-    DetailedGPUInfo detailed_gpu_info;
-    StorageInfo storage;
-    NetworkInfo net;
-    UserInfo user;
-    PerformanceInfo perf;
-    DisplayInfo di;
-    ExtraInfo extra;
-    SystemInfo sys;
-
-    CompactAudio c_audio;
-    CompactOS c_os;
-    CompactCPU c_cpu;
+    // "live" streams every section as soon as it is ready, "buffered" writes the
+    // whole frame at once (or in flush_bytes chunks) - fewer repaints over SSH.
+    string outputMode = cfg.text({ "output", "mode" }, "live");
+    size_t flushBytes = static_cast<size_t>(cfg.number({ "output", "flush_bytes" }, 0));
+    if (!outputModeArg.empty()) outputMode = outputModeArg;
+    LivePrinter lp(art, outputMode == "buffered" ? LivePrinter::Mode::Buffered : LivePrinter::Mode::Live, flushBytes);
+
+
+    // Collector registry: one lazy slot per module. Nothing is constructed
+    // here - a module is built the first time an enabled section uses it,
+    // so disabling a section in the config also removes its startup cost.
+    LazyModule<OSInfo> os;
+    LazyModule<CPUInfo> cpu;
+    LazyModule<MemoryInfo> ram;
+    LazyModule<GPUInfo> obj_gpu;
+    LazyModule<DetailedGPUInfo> detailed_gpu_info;
+    LazyModule<StorageInfo> storage;
+    LazyModule<NetworkInfo> net;
+    LazyModule<UserInfo> user;
+    LazyModule<PerformanceInfo> perf;
+    LazyModule<DisplayInfo> di;
+    LazyModule<SystemInfo> sys;
+
+    LazyModule<CompactAudio> c_audio;
+    LazyModule<CompactOS> c_os;
+    LazyModule<CompactCPU> c_cpu;
    // CompactScreen c_screen;
-    CompactMemory c_memory;
-    CompactSystem c_system;
-    CompactGPU c_gpu;
-    CompactPerformance c_perf;
-    CompactUser c_user;
-    CompactNetwork c_net;
-    DiskInfo disk;
-    TimeInfo time;
+    LazyModule<CompactMemory> c_memory;
+    LazyModule<CompactGPU> c_gpu;
+    LazyModule<CompactPerformance> c_perf;
+    LazyModule<CompactUser> c_user;
+    LazyModule<CompactNetwork> c_net;
+    LazyModule<DiskInfo> disk;
+    // (ExtraInfo, TimeInfo and CompactScreen are created inside their own sections)
+
+    // Collector scheduler: every enabled section below is queued as a job and
+    // starts collecting right away on the worker pool. scheduler.run() then
+    // streams the finished lines to LivePrinter in the order they were added.
+    unsigned schedulerWorkers = static_cast<unsigned>(cfg.number({ "scheduler", "workers" }, 0)); // 0 = auto
+    CollectorScheduler scheduler(lp, schedulerWorkers);
+
+    // Deadlines: --budget for the whole run, "timeout_ms" inside any section block
+    scheduler.setBudget(budgetMs);
+    for (const string& section : cfg.sections()) {
+        if (cfg.has({ section, "timeout_ms" })) {
+            scheduler.setTimeout(section, static_cast<unsigned>(cfg.number({ section, "timeout_ms" }, 0)));
+        }
+    }
+    if (cfg.has({ "scheduler", "placeholder" })) {
+        scheduler.setPlaceholder(cfg.text({ "scheduler", "placeholder" }, ""));
+    }
+
+    // --watch: the sections showing values that move are collected again on
+    // every tick ("watch": true / false in a section block overrides this),
+    // everything else keeps the lines of the first run
+    if (watch) {
+        scheduler.keepAlive();
+        for (const char* section : { "compact_time", "compact_os", "compact_memory",
+                                     "compact_performance", "performance_info" }) {
+            scheduler.setRepeating(section, true);
+        }
+        for (const string& section : cfg.sections()) {
+            if (cfg.has({ section, "watch" })) scheduler.setRepeating(section, cfg.flag({ section, "watch" }, false));
+        }
+        lp.keepFrame();
+    }
 
 
 
@@ -344,7 +683,7 @@ int main(){
         
 
         // BinaryFetch Header
-        if (isEnabled("header")) {
+        if (isEnabled("header")) scheduler.add("header", [&](SectionBuffer& lp) {
             ostringstream ss;
             ss << getColor("header", "prefix_color", "bright_red") << "~>> " << r
                 << getColor("header", "title_color", "green") << "BinaryFetch" << r
@@ -353,312 +692,90 @@ int main(){
             if (isSubEnabled("header", "show_line")) ss << getColor("header", "line_color", "white") << "_____________________________________________________" << r << " ";
 
             lp.push(ss.str());
-        }
+        });
 
 
 
         // Compact Time
-        if (isEnabled("compact_time"))
+        if (isEnabled("compact_time")) scheduler.add("compact_time", [&](SectionBuffer& lp)
         {
             TimeInfo time;
-            ostringstream ss;
-
-            if (isSubEnabled("compact_time", "show_emoji")) ss << getColor("compact_time", "emoji_color", "white") << u8"📅" << r << " ";
-
-            // Helper to get colors from nested time structure
-            auto getTimeColor = [&](const string& subsection, const string& key, const string& defaultColor = "white") -> string {
-                if (!config_loaded || !config.contains("compact_time")) return colors[defaultColor];
-                if (!config["compact_time"].contains(subsection)) return colors[defaultColor];
-                if (!config["compact_time"][subsection].contains("colors")) return colors[defaultColor];
-                if (!config["compact_time"][subsection]["colors"].contains(key)) return colors[defaultColor];
-
-                string colorName = config["compact_time"][subsection]["colors"][key].get<string>();
-                return colors.count(colorName) ? colors[colorName] : colors[defaultColor];
-                };
-
-            // ---------- TIME SECTION ----------
-            if (isNestedEnabled("compact_time", "time_section", "enabled")) {
-                ss << getTimeColor("time_section", "bracket", "white") << "(" << r;
-
-                if (isNestedEnabled("compact_time", "time_section", "show_label")) {
-                    ss << getTimeColor("time_section", "label", "white") << "Time: " << r;
-                }
-
-                bool wrote = false;
-
-                if (isNestedEnabled("compact_time", "time_section", "show_hour")) {
-                    ss << getTimeColor("time_section", "hour", "white")
-                        << setw(2) << setfill('0') << time.getHour() << r;
-                    wrote = true;
-                }
-
-                if (isNestedEnabled("compact_time", "time_section", "show_minute")) {
-                    if (wrote) ss << getTimeColor("time_section", "sep", "white") << ":" << r;
-                    ss << getTimeColor("time_section", "minute", "white")
-                        << setw(2) << setfill('0') << time.getMinute() << r;
-                    wrote = true;
-                }
-
-                if (isNestedEnabled("compact_time", "time_section", "show_second")) {
-                    if (wrote) ss << getTimeColor("time_section", "sep", "white") << ":" << r;
-                    ss << getTimeColor("time_section", "second", "white")
-                        << setw(2) << setfill('0') << time.getSecond() << r;
-                }
-
-                ss << getTimeColor("time_section", "bracket", "white") << ") " << r;
-            }
-
-            // ---------- DATE SECTION ----------
-            if (isNestedEnabled("compact_time", "date_section", "enabled"))
-            {
-                ss << getTimeColor("date_section", "bracket", "white") << "(" << r;
-
-                if (isNestedEnabled("compact_time", "date_section", "show_label")) {
-                    ss << getTimeColor("date_section", "label", "white") << "Date: " << r;
-                }
-
-                bool wrote = false;
-
-                if (isNestedEnabled("compact_time", "date_section", "show_day")) {
-                    ss << getTimeColor("date_section", "day", "white")
-                        << setw(2) << setfill('0') << time.getDay() << r;
-                    wrote = true;
-                }
-
-                if (isNestedEnabled("compact_time", "date_section", "show_month_name")) {
-                    if (wrote) ss << getTimeColor("date_section", "sep", "white") << " : " << r;
-                    ss << getTimeColor("date_section", "month_name", "white")
-                        << time.getMonthName() << r;
-                    wrote = true;
-                }
-
-                if (isNestedEnabled("compact_time", "date_section", "show_month_num")) {
-                    if (wrote) ss << " ";
-                    ss << getTimeColor("date_section", "month_num", "white")
-                        << setw(2) << setfill('0') << time.getMonthNumber() << r;
-                    wrote = true;
-                }
-
-                if (isNestedEnabled("compact_time", "date_section", "show_year")) {
-                    if (wrote) ss << getTimeColor("date_section", "sep", "white") << " : " << r;
-                    ss << getTimeColor("date_section", "year", "white")
-                        << time.getYearNumber() << r;
-                }
-
-                ss << getTimeColor("date_section", "bracket", "white") << ") " << r;
-            }
-
-            // ---------- WEEK SECTION ----------
-            if (isNestedEnabled("compact_time", "week_section", "enabled")) {
-                ss << getTimeColor("week_section", "bracket", "white") << "(" << r;
-
-                if (isNestedEnabled("compact_time", "week_section", "show_label")) {
-                    ss << getTimeColor("week_section", "label", "white") << "Week: " << r;
-                }
-
-                bool wrote = false;
-
-                if (isNestedEnabled("compact_time", "week_section", "show_num")) {
-                    ss << getTimeColor("week_section", "num", "white")
-                        << time.getWeekNumber() << r;
-                    wrote = true;
-                }
-
-                if (isNestedEnabled("compact_time", "week_section", "show_day_name")) {
-                    if (wrote) ss << getTimeColor("week_section", "sep", "white") << " - " << r;
-                    ss << getTimeColor("week_section", "day_name", "white")
-                        << time.getDayName() << r;
-                }
-
-                ss << getTimeColor("week_section", "bracket", "white") << ") " << r;
-            }
-
-            // ---------- LEAP YEAR SECTION ----------
-            if (isNestedEnabled("compact_time", "leap_section", "enabled")) {
-                ss << getTimeColor("leap_section", "bracket", "white") << "(" << r;
-
-                if (isNestedEnabled("compact_time", "leap_section", "show_label")) {
-                    ss << getTimeColor("leap_section", "label", "white") << "Leap Year: " << r;
-                }
-
-                if (isNestedEnabled("compact_time", "leap_section", "show_val")) {
-                    ss << getTimeColor("leap_section", "val", "white")
-                        << time.getLeapYear() << r;
-                }
-
-                ss << getTimeColor("leap_section", "bracket", "white") << ")" << r;
-            }
-
-            lp.push(ss.str());
-        }
+            auto twoDigits = [](int value) {
+                char text[16];
+                snprintf(text, sizeof(text), "%02d", value);
+                return string(text);
+            };
+
+            string hour = twoDigits(time.getHour());
+            string minute = twoDigits(time.getMinute());
+            string second = twoDigits(time.getSecond());
+            string day = twoDigits(time.getDay());
+            string monthName = timeLine.uses("month_name") ? time.getMonthName() : string();
+            string month = twoDigits(time.getMonthNumber());
+            string dayName = timeLine.uses("day_name") ? time.getDayName() : string();
+            string leap = timeLine.uses("leap") ? time.getLeapYear() : string();
+
+            timeLine.render({ hour, minute, second, day, monthName, month, time.getYearNumber(),
+                time.getWeekNumber(), dayName, leap }, timeText);
+            lp.push(timeText);
+        });
 
         // Compact OS
-        if (isEnabled("compact_os")) {
-            ostringstream ss;
-
-            if (isSubEnabled("compact_os", "show_emoji")) ss << getColor("compact_os", "emoji_color", "white") << u8"🚀 " << r ;
-
-            ss << getColor("compact_os", "OS", "white") << "OS" << r
-                << getColor("compact_os", "OS_:", "white") << ": " << r;
-
-            
-            if (isSubEnabled("compact_os", "show_name")) ss << getColor("compact_os", "name_color", "white") << c_os.getOSName() << r << " ";
-            if (isSubEnabled("compact_os", "show_build")) ss << getColor("compact_os", "build_color", "white") << c_os.getOSBuild() << r;
+        if (isEnabled("compact_os")) scheduler.add("compact_os", [&](SectionBuffer& lp) {
+            // only what the layout shows is probed
+            string name = osLine.uses("name") ? c_os->getOSName() : string();
+            string build = osLine.uses("build") ? c_os->getOSBuild() : string();
+            string arch = osLine.uses("arch") ? c_os->getArchitecture() : string();
+            string uptime = osLine.uses("uptime") ? c_os->getUptime() : string();
 
-            if (isSubEnabled("compact_os", "show_arch")) {
-                ss << getColor("compact_os", "(", "white") << " (" << r
-                    << getColor("compact_os", "arch_color", "white") << c_os.getArchitecture() << r
-                    << getColor("compact_os", ")", "white") << ")" << r;
-            }
-
-            if (isSubEnabled("compact_os", "show_uptime")) {
-                ss << getColor("compact_os", "(", "white") << " (" << r
-                    << getColor("compact_os", "uptime_label_color", "white") << "uptime: " << r
-                    << getColor("compact_os", "uptime_value_color", "white") << c_os.getUptime() << r
-                    << getColor("compact_os", ")", "white") << ")" << r;
-            }
-            lp.push(ss.str());
-        }
+            osLine.render({ name, build, arch, uptime }, osText);
+            lp.push(osText);
+        });
 
         // Compact CPU
-        if (isEnabled("compact_cpu")) {
-            ostringstream ss;
-
-            if (isSubEnabled("compact_cpu", "show_emoji")) ss << getColor("compact_cpu", "emoji_color", "white") << u8"🧠 " << r;
+        if (isEnabled("compact_cpu")) scheduler.add("compact_cpu", [&](SectionBuffer& lp) {
+            string name = cpuLine.uses("name") ? c_cpu->getCPUName() : string();
+            string cores = cpuLine.uses("cores") ? c_cpu->getCPUCores() : string();
+            string threads = cpuLine.uses("threads") ? c_cpu->getCPUThreads() : string();
+            double clockGHz = cpuLine.uses("clock") ? c_cpu->getClockSpeed() : 0.0;
 
-            ss << getColor("compact_cpu", "CPU", "white") << "CPU" << r
-                << getColor("compact_cpu", "CPU_:", "white") << ": " << r;
-
-            if (isSubEnabled("compact_cpu", "show_name")) ss << getColor("compact_cpu", "name_color", "white") << c_cpu.getCPUName() << r;
-
-            if (isSubEnabled("compact_cpu", "show_cores") || isSubEnabled("compact_cpu", "show_threads")) {
-                ss << getColor("compact_cpu", "(", "white") << " (" << r;
-                if (isSubEnabled("compact_cpu", "show_cores")) ss << getColor("compact_cpu", "core_color", "white") << c_cpu.getCPUCores() << r << getColor("compact_cpu", "text_color", "white") << "C" << r;
-                if (isSubEnabled("compact_cpu", "show_cores") && isSubEnabled("compact_cpu", "show_threads")) ss << getColor("compact_cpu", "separator_color", "white") << "/" << r;
-                if (isSubEnabled("compact_cpu", "show_threads")) ss << getColor("compact_cpu", "thread_color", "white") << c_cpu.getCPUThreads() << r << getColor("compact_cpu", "text_color", "white") << "T" << r;
-                ss << getColor("compact_cpu", ")", "white") << ")" << r;
-            }
-             
-            if (isSubEnabled("compact_cpu", "show_clock")) {
-                ss << fixed << setprecision(2)
-                    << getColor("compact_cpu", "at_symbol_color", "white") << " @" << r
-                    << getColor("compact_cpu", "clock_color", "white") << " " << c_cpu.getClockSpeed() << " GHz" << r;
-            }
-            lp.push(ss.str());
-        }
+            cpuLine.render({ name, cores, threads, clockGHz }, cpuText);
+            lp.push(cpuText);
+        });
 
 
         // Compact GPU
-        if (isEnabled("compact_gpu")) {
-            ostringstream ss;
-
-            if (isSubEnabled("compact_gpu", "show_emoji")) ss << getColor("compact_gpu", "emoji_color", "white") << u8"🔥" << r << " ";
-
-            ss << getColor("compact_gpu", "GPU", "white") << "GPU" << r
-                << getColor("compact_gpu", "GPU_:", "white") << ": " << r;
-
-            if (isSubEnabled("compact_gpu", "show_name")) ss << getColor("compact_gpu", "name_color", "white") << c_gpu.getGPUName() << r;
+        if (isEnabled("compact_gpu")) scheduler.add("compact_gpu", "gpu", [&](SectionBuffer& lp) {
+            string name = gpuLine.uses("name") ? c_gpu->getGPUName() : string();
+            int usage = gpuLine.uses("usage") ? c_gpu->getGPUUsagePercent() : 0;
+            double vram = gpuLine.uses("vram") ? c_gpu->getVRAMGB() : 0.0;
+            string freq = gpuLine.uses("freq") ? c_gpu->getGPUFrequency() : string();
 
-            if (isSubEnabled("compact_gpu", "show_usage")) {
-                ss << getColor("compact_gpu", "(", "white") << " (" << r
-                    << getColor("compact_gpu", "usage_color", "white") << c_gpu.getGPUUsagePercent() << "%" << r
-                    << getColor("compact_gpu", ")", "white") << ")" << r;
-            }
-
-            if (isSubEnabled("compact_gpu", "show_vram")) {
-                ss << getColor("compact_gpu", "(", "white") << " (" << r
-                    << getColor("compact_gpu", "vram_color", "white") << c_gpu.getVRAMGB() << " GB" << r
-                    << getColor("compact_gpu", ")", "white") << ")" << r;
-            }
-
-            if (isSubEnabled("compact_gpu", "show_freq")) {
-                ss << getColor("compact_gpu", "(", "white") << " (" << r
-                    << getColor("compact_gpu", "at_symbol_color", "white") << "@" << r
-                    << getColor("compact_gpu", "freq_color", "white") << c_gpu.getGPUFrequency() << r
-                    << getColor("compact_gpu", ")", "white") << ")" << r;
-            }
-            lp.push(ss.str());
-        }
+            gpuLine.render({ name, usage, vram, freq }, gpuText);
+            lp.push(gpuText);
+        });
 
 
         // Compact Screen
-        if (isEnabled("compact_screen")) {
+        if (isEnabled("compact_screen")) scheduler.add("compact_screen", "gpu", [&](SectionBuffer& lp) {
             CompactScreen screenDetector;
             auto screens = screenDetector.getScreens();
-            ostringstream ss;
-
-
-            
 
             if (screens.empty()) {
                 // No displays detected - show error message
-                ostringstream ss;
-                ss << getColor("compact_screen", "Display", "white") << "Display" << r
-                    << getColor("compact_screen", "Display_:", "blue") << ": " << r
-                    << getColor("compact_screen", "name_color", "white") << "No displays detected" << r;
-                lp.push(ss.str());
+                noScreenLine.render({}, screenText);
+                lp.push(screenText);
+                return;
             }
-            else {
-                // Display each detected screen
-                for (size_t i = 0; i < screens.size(); ++i) {
-                    const auto& screen = screens[i];
-                    ostringstream ss;
-
-                    if (isSubEnabled("compact_screen", "show_emoji")) ss << getColor("compact_screen", "emoji_color", "white") << u8"📺" << r << " ";
 
-                    // Header: [Display N] ->
-                    ss << getColor("compact_screen", "Display", "white")
-                        << "Display " << (i + 1) << "" << r
-                        << getColor("compact_screen", "Display_:", "white") << ": " << r;
-
-                    // Display name
-                    if (isSubEnabled("compact_screen", "show_name")) {
-                        ss << getColor("compact_screen", "name_color", "white")
-                            << screen.name << r << " ";
-                    }
-
-                    // Resolution: (3840 x 2160)
-                    if (isSubEnabled("compact_screen", "show_resolution")) {
-                        ss << getColor("compact_screen", "(", "white") << "(" << r
-                            << getColor("compact_screen", "resolution_color", "White")
-                            << screen.native_width << r
-                            << getColor("compact_screen", "x", "white") << " x " << r
-                            << getColor("compact_screen", "resolution_color", "white")
-                            << screen.native_height << r
-                            << getColor("compact_screen", ")", "white") << ") " << r;
-                    }
-
-                    // Scale: (scale: 175%)
-                    if (isSubEnabled("compact_screen", "show_scale")) {
-                        ss << getColor("compact_screen", "(", "white") << "(" << r
-                            << getColor("compact_screen", "scale_label", "white") << "Scale: " << r
-                            << getColor("compact_screen", "scale_value", "white")
-                            << screen.scale_percent << "%" << r
-                            << getColor("compact_screen", ")", "white") << ") " << r;
-                    }
-
-                    // Upscale: (upscale: 4x)
-                    if (isSubEnabled("compact_screen", "show_upscale")) {
-                        ss << getColor("compact_screen", "(", "white") << "(" << r
-                            << getColor("compact_screen", "upscale_label", "white") << "upscale: " << r
-                            << getColor("compact_screen", "upscale_value", "white")
-                            << screen.upscale << r
-                            << getColor("compact_screen", ")", "white") << ") " << r;
-                    }
-
-                    // Refresh rate: 
-                    if (isSubEnabled("compact_screen", "show_refresh")) {
-                        ss << getColor("compact_screen", "(", "white") << "(" << r
-                            << getColor("compact_screen", "@", "white") << "@" << r
-                            << getColor("compact_screen", "refresh_color", "white")
-                            << screen.refresh_rate << "Hz" << r
-                            << getColor("compact_screen", ")", "white") << ")" << r;
-                    }
-
-                    lp.push(ss.str());
-                }
+            // Display each detected screen
+            for (size_t i = 0; i < screens.size(); ++i) {
+                const auto& screen = screens[i];
+                screenLine.render({ static_cast<int>(i + 1), screen.name, screen.native_width, screen.native_height,
+                    screen.scale_percent, screen.upscale, screen.refresh_rate }, screenText);
+                lp.push(screenText);
             }
-        }
+        });
         /*
         
         ## 🎨 Output Examples
@@ -685,220 +802,116 @@ int main(){
 
 
         // Compact Memory
-        if (isEnabled("compact_memory")) {
-            ostringstream ss;
-
-            if (isSubEnabled("compact_memory", "show_emoji")) ss << getColor("compact_memory", "emoji_color", "white") << u8"📟" << r << " ";
+        if (isEnabled("compact_memory")) scheduler.add("compact_memory", [&](SectionBuffer& lp) {
+            double total = memoryLine.uses("total") ? c_memory->get_total_memory() : 0.0;
+            double available = memoryLine.uses("free") ? c_memory->get_free_memory() : 0.0;
+            double percent = memoryLine.uses("percent") ? c_memory->get_used_memory_percent() : 0.0;
 
-            ss << getColor("compact_memory", "Memory", "white") << "Memory" << r
-                << getColor("compact_memory", "Memory_:", "white") << ": " << r;
-
-            if (isSubEnabled("compact_memory", "show_total")) {
-                ss << getColor("compact_memory", "(", "white") << "(" << r
-                    << getColor("compact_memory", "label_color", "white") << "total: " << r
-                    << getColor("compact_memory", "total_color", "white") << c_memory.get_total_memory() << " GB" << r
-                    << getColor("compact_memory", ")", "white") << ")" << r;
-            }
-            if (isSubEnabled("compact_memory", "show_free")) {
-                ss << " " << getColor("compact_memory", "(", "white") << "(" << r
-                    << getColor("compact_memory", "label_color", "white") << "free: " << r
-                    << getColor("compact_memory", "free_color", "white") << c_memory.get_free_memory() << " GB" << r
-                    << getColor("compact_memory", ")", "white") << ")" << r;
-            }
-            if (isSubEnabled("compact_memory", "show_percent")) {
-                ss << " " << getColor("compact_memory", "(", "white") << "(" << r
-                    << getColor("compact_memory", "percent_color", "white") << c_memory.get_used_memory_percent() << "%" << r
-                    << getColor("compact_memory", ")", "white") << ")" << r;
-            }
-            lp.push(ss.str());
-        }
+            memoryLine.render({ total, available, percent }, memoryText);
+            lp.push(memoryText);
+        });
 
         // Compact Audio
-        if (isEnabled("compact_audio")) {
+        if (isEnabled("compact_audio")) scheduler.add("compact_audio", [&](SectionBuffer& lp) {
             if (isSubEnabled("compact_audio", "show_input")) {
-                ostringstream ss1;
-
-                if (isSubEnabled("compact_audio", "show_audio_input_emoji")) ss1 << getColor("compact_audio", "audio_output_emoji_color", "white") << u8"🎙️" << r << " ";
-
-                ss1 << getColor("compact_audio", "Audio Input", "white") << "Audio Input" << r
-                    << getColor("compact_audio", "Audio_Input_:", "white") << ": " << r
-                    << getColor("compact_audio", "device_color", "white") << c_audio.active_audio_input() << r << " "
-                    << getColor("compact_audio", "(", "white") << "[" << r
-                    << getColor("compact_audio", "status_color", "white") << c_audio.active_audio_input_status() << r
-                    << getColor("compact_audio", ")", "white") << "]" << r;
-                lp.push(ss1.str());
+                string device = audioInputLine.uses("device") ? c_audio->active_audio_input() : string();
+                string status = audioInputLine.uses("status") ? c_audio->active_audio_input_status() : string();
+                audioInputLine.render({ device, status }, audioText);
+                lp.push(audioText);
             }
             if (isSubEnabled("compact_audio", "show_output")) {
-                ostringstream ss2;
-
-                if (isSubEnabled("compact_audio", "show_audio_output_emoji")) ss2 << getColor("compact_audio", "audio_input_emoji_color", "white") << u8"🎧" << r << " ";
-
-                ss2 << getColor("compact_audio", "Audio Output", "white") << "Audio Output" << r
-                    << getColor("compact_audio", "Audio_Output_:", "white") << ": " << r
-                    << getColor("compact_audio", "device_color", "white") << c_audio.active_audio_output() << r << " "
-                    << getColor("compact_audio", "(", "white") << "[" << r
-                    << getColor("compact_audio", "status_color", "white") << c_audio.active_audio_output_status() << r
-                    << getColor("compact_audio", ")", "white") << "]" << r;
-                lp.push(ss2.str());
+                string device = audioOutputLine.uses("device") ? c_audio->active_audio_output() : string();
+                string status = audioOutputLine.uses("status") ? c_audio->active_audio_output_status() : string();
+                audioOutputLine.render({ device, status }, audioText);
+                lp.push(audioText);
             }
-        }
+        });
 
         // Compact Performance
-        if (isEnabled("compact_performance")) {
-            ostringstream ss;
-
-            if (isSubEnabled("compact_performancec", "show_emoji")) ss << getColor("compact_performance", "emoji_color", "white") << u8"🔋" << r << " ";
-
-            ss << getColor("compact_performance", "Performance", "white") << "Performance" << r
-                << getColor("compact_performance", "Performance_:", "white") << ": " << r;
-
-            auto addP = [&](const string& subKey, const string& label, const string& colorKey, auto val) {
-                if (isSubEnabled("compact_performance", subKey)) {
-                    ss << getColor("compact_performance", "(", "white") << "(" << r
-                        << getColor("compact_performance", "label_color", "white") << label << ": " << r
-                        << getColor("compact_performance", colorKey, "white") << val << "%" << r
-                        << getColor("compact_performance", ")", "white") << ") " << r;
-                }
-                };
-            addP("show_cpu", "CPU", "cpu_color", c_perf.getCPUUsage());
-            addP("show_gpu", "GPU", "gpu_color", c_perf.getGPUUsage());
-            addP("show_ram", "RAM", "ram_color", c_perf.getRAMUsage());
-            addP("show_disk", "Disk", "disk_color", c_perf.getDiskUsage());
-            lp.push(ss.str());
-        }
+        if (isEnabled("compact_performance")) scheduler.add("compact_performance", "gpu", [&](SectionBuffer& lp) {
+            int cpuUsage = perfLine.uses("cpu") ? c_perf->getCPUUsage() : 0;
+            int gpuUsage = perfLine.uses("gpu") ? c_perf->getGPUUsage() : 0;
+            int ramUsage = perfLine.uses("ram") ? c_perf->getRAMUsage() : 0;
+            // "disk_usage_mode": "space" (used on C:, the default) or "busy"
+            int diskUsage = !perfLine.uses("disk") ? 0
+                : cfg.text({ "compact_performance", "disk_usage_mode" }, "space") == "busy" ? c_perf->getDiskBusy()
+                : c_perf->getDiskUsage();
+
+            perfLine.render({ cpuUsage, gpuUsage, ramUsage, diskUsage }, perfText);
+            lp.push(perfText);
+        });
 
         // Compact User
-        if (isEnabled("compact_user")) {
-            ostringstream ss;
+        if (isEnabled("compact_user")) scheduler.add("compact_user", [&](SectionBuffer& lp) {
+            string username = userLine.uses("username") ? c_user->getUsername() : string();
+            string domain = userLine.uses("domain") ? c_user->getDomain() : string();
+            string type = userLine.uses("type") ? c_user->isAdmin() : string();
 
-            if (isSubEnabled("compact_user", "show_emoji")) ss << getColor("compact_user", "emoji_color", "white") << u8"☕" << r << " ";
-
-            ss << getColor("compact_user", "User", "white") << "User" << r
-                << getColor("compact_user", "User_:", "white") << ": " << r;
-
-            if (isSubEnabled("compact_user", "show_username")) ss << getColor("compact_user", "username_color", "white") << "@" << c_user.getUsername() << r;
-            if (isSubEnabled("compact_user", "show_domain")) {
-                ss << " " << getColor("compact_user", "(", "white") << "(" << r
-                    << getColor("compact_user", "label_color", "white") << "Domain: " << r
-                    << getColor("compact_user", "domain_color", "white") << c_user.getDomain() << r
-                    << getColor("compact_user", ")", "white") << ")" << r;
-            }
-            if (isSubEnabled("compact_user", "show_type")) {
-                ss << " " << getColor("compact_user", "(", "white") << "(" << r
-                    << getColor("compact_user", "label_color", "white") << "Type: " << r
-                    << getColor("compact_user", "type_color", "white") << c_user.isAdmin() << r
-                    << getColor("compact_user", ")", "white") << ")" << r;
-            }
-            lp.push(ss.str());
-        }
+            userLine.render({ username, domain, type }, userText);
+            lp.push(userText);
+        });
 
 
 
             // Compact Network (real)
-            if (isEnabled("compact_network")) {
-                ostringstream ss;
+            if (isEnabled("compact_network")) scheduler.add("compact_network", [&](SectionBuffer& lp) {
+                string name = networkLine.uses("name") ? c_net->get_network_name() : string();
+                string type = networkLine.uses("type") ? c_net->get_network_type() : string();
+                string ip = networkLine.uses("ip") ? c_net->get_network_ip() : string();
 
-                if (isSubEnabled("compact_network", "show_emoji")) ss << getColor("compact_network", "emoji_color", "white") << u8"🌐" << r << " ";
+                networkLine.render({ name, type, ip }, networkText);
+                lp.push(networkText);
+            });
 
-                ss << getColor("compact_network", "Network", "white") << "Network" << r
-                    << getColor("compact_network", "Network_:", "white") << ": " << r;
 
-                if (isSubEnabled("compact_network", "show_name")) {
-                    ss << getColor("compact_network", "(", "white") << "(" << r
-                        << getColor("compact_network", "label_color", "white") << "Name: " << r
-                        << getColor("compact_network", "name_color", "white") << c_net.get_network_name() << r
-                        << getColor("compact_network", ")", "white") << ") " << r;
-                }
-                if (isSubEnabled("compact_network", "show_type")) {
-                    ss << getColor("compact_network", "(", "white") << "(" << r
-                        << getColor("compact_network", "label_color", "white") << "Type: " << r
-                        << getColor("compact_network", "type_color", "white") << c_net.get_network_type() << r
-                        << getColor("compact_network", ")", "white") << ") " << r;
-                }
-                if (isSubEnabled("compact_network", "show_ip")) {
-                    ss << getColor("compact_network", "(", "white") << "(" << r
-                        << getColor("compact_network", "label_color", "white") << "ip: " << r
-                        << getColor("compact_network", "ip_color", "white") << c_net.get_network_ip() << r
-                        << getColor("compact_network", ")", "white") << ")" << r;
-                }
-                lp.push(ss.str());
-            }
 
 
 
+            // Compact Network (dummy) - same layout, made-up name and address
+            if (isEnabled("dummy_compact_network")) scheduler.add("dummy_compact_network", [&](SectionBuffer& lp) {
+                string type = networkLine.uses("type") ? c_net->get_network_type() : string();
 
-
-            // Compact Network (dummy)
-            if (isEnabled("dummy_compact_network")) {
-                ostringstream ss;
-
-                if (isSubEnabled("compact_network", "show_emoji")) ss << getColor("compact_network", "emoji_color", "white") << u8"🌐" << r << " ";
-
-                ss << getColor("compact_network", "Network", "white") << "Network" << r
-                    << getColor("compact_network", "Network_:", "white") << ": " << r;
-
-                if (isSubEnabled("compact_network", "show_name")) {
-                    ss << getColor("compact_network", "(", "white") << "(" << r
-                        << getColor("compact_network", "label_color", "white") << "Name: " << r
-                        << getColor("compact_network", "name_color", "white") << "InterCentury" << r
-                        << getColor("compact_network", ")", "white") << ") " << r;
-                }
-                if (isSubEnabled("compact_network", "show_type")) {
-                    ss << getColor("compact_network", "(", "white") << "(" << r
-                        << getColor("compact_network", "label_color", "white") << "Type: " << r
-                        << getColor("compact_network", "type_color", "white") << c_net.get_network_type() << r
-                        << getColor("compact_network", ")", "white") << ") " << r;
-                }
-                if (isSubEnabled("compact_network", "show_ip")) {
-                    ss << getColor("compact_network", "(", "white") << "(" << r
-                        << getColor("compact_network", "label_color", "white") << "ip: " << r
-                        << getColor("compact_network", "ip_color", "white") << "203.0.113.45" << r
-                        << getColor("compact_network", ")", "white") << ")" << r;
-                }
-                lp.push(ss.str());
-            }
+                networkLine.render({ "InterCentury", type, "203.0.113.45" }, dummyNetworkText);
+                lp.push(dummyNetworkText);
+            });
 
 
         
         
 
         // Compact Disk
-        if (isEnabled("compact_disk")) {
+        // one line per kind, the drives are rendered by the item template
+        // and joined into its {drives} field
+        if (isEnabled("compact_disk")) scheduler.add("compact_disk", [&](SectionBuffer& lp) {
             if (isSubEnabled("compact_disk", "show_usage")) {
-                auto disks = disk.getAllDiskUsage();
-                ostringstream ss;
-
-                if (isSubEnabled("compact_disk", "show_disk_usage_emoji")) ss << getColor("compact_disk", "disk_usage_emoji_color", "white") << u8"📂" << r << " ";
-
-                ss << getColor("compact_disk", "Disk Usage", "white") << "Disk Usage" << r << getColor("compact_disk", "Disk_Usage_:", "white") << ": " << r;
+                auto disks = disk->getAllDiskUsage();
+                diskDrives.clear();
                 for (const auto& d : disks) {
-                    ss << getColor("compact_disk", "(", "white") << "(" << r << getColor("compact_disk", "letter_color", "white") << d.first[0] << ":" << r
-                        << " " << getColor("compact_disk", "percent_color", "white") << fixed << setprecision(1) << d.second << "%" << r
-                        << getColor("compact_disk", ")", "white") << ") " << r;
+                    string letter(1, d.first[0]);
+                    diskUsageItem.render({ letter, d.second }, diskItem);
+                    diskDrives += diskItem;
                 }
-                lp.push(ss.str());
+                diskUsageLine.render({ diskDrives }, diskText);
+                lp.push(diskText);
             }
 
             if (isSubEnabled("compact_disk", "show_capacity")) {
-                auto caps = disk.getDiskCapacity();
-                ostringstream sc;
-
-                if (isSubEnabled("compact_disk", "show_disk_capacity_emoji")) sc << getColor("compact_disk", "disk_capacity_emoji_color", "white") << u8"📊" << r << " ";
-
-                sc << getColor("compact_disk", "Disk Cap", "white") << "Disk Cap" << r << getColor("compact_disk", "Disk_Cap_:", "white") << ": " << r;
+                auto caps = disk->getDiskCapacity();
+                diskDrives.clear();
                 for (const auto& c : caps) {
-                    sc << getColor("compact_disk", "(", "white") << "(" << r << getColor("compact_disk", "letter_color", "white") << c.first[0] << r
-                        << getColor("compact_disk", "separator_color", "white") << "-" << r << getColor("compact_disk", "capacity_color", "white") << c.second << "GB" << r
-                        << getColor("compact_disk", ")", "white") << ")" << r;
+                    string letter(1, c.first[0]);
+                    diskCapacityItem.render({ letter, c.second }, diskItem);
+                    diskDrives += diskItem;
                 }
-                lp.push(sc.str());
+                diskCapacityLine.render({ diskDrives }, diskText);
+                lp.push(diskText);
             }
-        }
+        });
 
         //-----------------------------start of detailed modules----------------------//
 
         // ----------------- DETAILED MEMORY SECTION ----------------- //
-        if (isEnabled("detailed_memory")) {
+        if (isEnabled("detailed_memory")) scheduler.add("detailed_memory", [&](SectionBuffer& lp) {
             lp.push(""); // blank line
 
             // ---------- HEADER ----------
@@ -921,7 +934,7 @@ int main(){
                     ss << getColor("detailed_memory", "~", "white") << "~" << r
                         << getColor("detailed_memory", "brackets", "white") << " (" << r
                         << getColor("detailed_memory", "label", "white") << "Total: " << r
-                        << getColor("detailed_memory", "total_value", "white") << ram.getTotal() << " GB" << r
+                        << getColor("detailed_memory", "total_value", "white") << ram->getTotal() << " GB" << r
                         << getColor("detailed_memory", "brackets", "white") << ") " << r;
                 }
 
@@ -929,7 +942,7 @@ int main(){
                 if (isSectionEnabled("detailed_memory", "free")) {
                     ss << getColor("detailed_memory", "brackets", "white") << "(" << r
                         << getColor("detailed_memory", "label", "white") << "Free: " << r
-                        << getColor("detailed_memory", "free_value", "white") << ram.getFree() << " GB" << r
+                        << getColor("detailed_memory", "free_value", "white") << ram->getFree() << " GB" << r
                         << getColor("detailed_memory", "brackets", "white") << ") " << r;
                 }
 
@@ -937,7 +950,7 @@ int main(){
                 if (isSectionEnabled("detailed_memory", "used_percentage")) {
                     ss << getColor("detailed_memory", "brackets", "white") << "(" << r
                         << getColor("detailed_memory", "label", "white") << "Used: " << r
-                        << getColor("detailed_memory", "used_value", "white") << ram.getUsedPercentage() << "%" << r
+                        << getColor("detailed_memory", "used_value", "white") << ram->getUsedPercentage() << "%" << r
                         << getColor("detailed_memory", "brackets", "white") << ")" << r;
                 }
 
@@ -946,7 +959,7 @@ int main(){
 
             // ---------- MODULES ----------
             if (isSectionEnabled("detailed_memory", "modules")) {
-                const auto& modules = ram.getModules();
+                const auto& modules = ram->getModules();
                 for (size_t i = 0; i < modules.size(); ++i) {
                     // --- Zero-pad capacity ---
                     string cap = modules[i].capacity;
@@ -965,7 +978,7 @@ int main(){
                     // Used Percentage in parentheses
                     ss << getColor("detailed_memory", "brackets", "white") << "(" << r
                         << getColor("detailed_memory", "label", "white") << "Used: " << r
-                        << getColor("detailed_memory", "used_value", "white") << ram.getUsedPercentage() << "%" << r
+                        << getColor("detailed_memory", "used_value", "white") << ram->getUsedPercentage() << "%" << r
                         << getColor("detailed_memory", "brackets", "white") << ") " << r;
 
                     // Capacity, Type, and Speed
@@ -976,58 +989,23 @@ int main(){
                     lp.push(ss.str());
                 }
             }
-        }
+        });
 
 
         // ----------------- DETAILED STORAGE SECTION (FIXED) ----------------- //
-        if (isEnabled("detailed_storage")) {
+        if (isEnabled("detailed_storage")) scheduler.add("detailed_storage", [&](SectionBuffer& lp) {
             lp.push("");
 
             // Helper function to get nested color values - Defaulted to white
-            auto getNestedColor = [&](const string& path, const string& defaultColor = "white") -> string {
-                if (!config_loaded || !config.contains("detailed_storage")) return colors[defaultColor];
-
-                vector<string> keys;
-                stringstream ss(path);
-                string key;
-                while (getline(ss, key, '.')) {
-                    keys.push_back(key);
-                }
-
-                json current = config["detailed_storage"];
-                for (const auto& k : keys) {
-                    if (!current.contains(k)) return colors[defaultColor];
-                    current = current[k];
-                }
-
-                if (current.is_string()) {
-                    string colorName = current.get<string>();
-                    return colors.count(colorName) ? colors[colorName] : colors[defaultColor];
-                }
-                return colors[defaultColor];
+            // (paths are dotted, "storage_summary.header.show_header", which is
+            // exactly how ConfigIndex keys nested nodes)
+            auto getNestedColor = [&](ConfigKey path, ConfigKey defaultColor = "white") -> const string& {
+                return cfg.color({ "detailed_storage", path }, defaultColor);
                 };
 
             // Helper to check nested boolean values
-            auto getNestedBool = [&](const string& path, bool defaultValue = true) -> bool {
-                if (!config_loaded || !config.contains("detailed_storage")) return defaultValue;
-
-                vector<string> keys;
-                stringstream ss(path);
-                string key;
-                while (getline(ss, key, '.')) {
-                    keys.push_back(key);
-                }
-
-                json current = config["detailed_storage"];
-                for (const auto& k : keys) {
-                    if (!current.contains(k)) return defaultValue;
-                    current = current[k];
-                }
-
-                if (current.is_boolean()) {
-                    return current.get<bool>();
-                }
-                return defaultValue;
+            auto getNestedBool = [&](ConfigKey path, bool defaultValue = true) -> bool {
+                return cfg.flag({ "detailed_storage", path }, defaultValue);
                 };
 
             auto fmt_storage = [](const string& s) -> string {
@@ -1041,13 +1019,19 @@ int main(){
                 return oss.str();
                 };
 
+            // a figure gets 2 decimals; anything else ("---" for a test that
+            // didn't run) is shown as it is, never as a made-up 0.00
             auto fmt_speed = [](const string& s) -> string {
-                ostringstream tmp;
+                string val = s;
+                size_t used = 0;
                 double v = 0.0;
-                try { v = stod(s); }
-                catch (...) { v = 0.0; }
-                tmp << fixed << setprecision(2) << v;
-                string val = tmp.str();
+                try { v = stod(s, &used); }
+                catch (...) { used = 0; }
+                if (used > 0 && used == s.size()) {
+                    ostringstream tmp;
+                    tmp << fixed << setprecision(2) << v;
+                    val = tmp.str();
+                }
                 int padding = 7 - (int)val.size();
                 if (padding < 0) padding = 0;
                 return string(padding, ' ') + val;
@@ -1055,6 +1039,18 @@ int main(){
 
             vector<storage_data> all_disks_captured;
 
+            // Speed test settings ("benchmark" block, see DiskBenchmark.h)
+            BenchmarkOptions bench;
+            bench.queueDepth = static_cast<unsigned>(cfg.number({ "detailed_storage", "benchmark.queue_depth" }, bench.queueDepth));
+            bench.durationMs = static_cast<unsigned>(cfg.number({ "detailed_storage", "benchmark.duration_ms" }, bench.durationMs));
+            bench.warmupMs = static_cast<unsigned>(cfg.number({ "detailed_storage", "benchmark.warmup_ms" }, bench.warmupMs));
+            bench.fileMb = static_cast<unsigned>(cfg.number({ "detailed_storage", "benchmark.file_mb" }, bench.fileMb));
+            bench.write = cfg.flag({ "detailed_storage", "benchmark.write" }, bench.write);
+            bench.writeBudgetMb = static_cast<unsigned>(cfg.number({ "detailed_storage", "benchmark.write_budget_mb" }, bench.writeBudgetMb));
+            bench.parallelDevices = static_cast<unsigned>(cfg.number({ "detailed_storage", "benchmark.parallel_devices" }, bench.parallelDevices));
+            storage->set_benchmark_options(bench);
+            storage->set_concurrency(static_cast<unsigned>(cfg.number({ "detailed_storage", "concurrency" }, 4)));
+
             // STORAGE SUMMARY SECTION
             if (getNestedBool("sections.storage_summary", true)) {
 
@@ -1067,10 +1063,9 @@ int main(){
                     lp.push(ss.str());
                 }
 
-                // Process each disk
-                storage.process_storage_info([&](const storage_data& d) {
-                    all_disks_captured.push_back(d);
-
+                // Process each disk: its summary line as soon as it is sized,
+                // the speed figures (DISK PERFORMANCE below) once its disk is measured
+                storage->process_storage_info([&](const storage_data& d) {
                     ostringstream ss;
 
                     // Storage type
@@ -1158,7 +1153,8 @@ int main(){
                     ss << getNestedColor("storage_summary.]", "white") << " ]" << r;
 
                     lp.push(ss.str());
-                    });
+                    },
+                    [&](const storage_data& d) { all_disks_captured.push_back(d); });
             }
 
             // DISK PERFORMANCE SECTION
@@ -1203,6 +1199,27 @@ int main(){
                     ss << getNestedColor("disk_performance.speed_unit_color", "white") << " MB/s " << r
                         << getNestedColor("disk_performance.|", "white") << "|" << r << " ";
 
+                    // Random 4K: read (/ write, when it ran) IOPS and their p99 latency
+                    if (getNestedBool("disk_performance.show_random_4k", false) && d.benchmark.randRead.ok) {
+                        const BenchmarkResult& rr = d.benchmark.randRead;
+                        const BenchmarkResult& rw = d.benchmark.randWrite;
+                        ostringstream k;
+                        k << fixed << setprecision(1) << "4K: " << rr.iops / 1000.0 << "k";
+                        if (rw.ok) k << "/" << rw.iops / 1000.0 << "k";
+                        k << " IOPS p99 " << setprecision(2) << rr.p99Us / 1000.0;
+                        if (rw.ok) k << "/" << rw.p99Us / 1000.0;
+                        k << " ms";
+                        ss << getNestedColor("disk_performance.random_4k_color", "white") << k.str() << r << " "
+                            << getNestedColor("disk_performance.|", "white") << "|" << r << " ";
+                    }
+
+                    // Age of a cached result (none when the test ran now)
+                    if (getNestedBool("disk_performance.show_benchmark_age", true) && d.benchmark_age >= 0) {
+                        ss << getNestedColor("disk_performance.benchmark_age_color", "white")
+                            << "(" << BenchmarkCache::formatAge(d.benchmark_age) << " ago)" << r << " "
+                            << getNestedColor("disk_performance.|", "white") << "|" << r << " ";
+                    }
+
                     // Serial number
                     if (getNestedBool("disk_performance.show_serial_number", true)) {
                         ss << getNestedColor("disk_performance.serial_number_color", "white") << d.serial_number << r;
@@ -1291,13 +1308,13 @@ int main(){
             if (all_disks_captured.empty()) {
                 lp.push("No drives detected.");
             }
-        }
+        });
         // ----------------- END DETAILED STORAGE ----------------- //
 
 
 
             // Network Info (Compact + Extra) (real)
-            if (isEnabled("network_info")) 
+            if (isEnabled("network_info")) scheduler.add("network_info", [&](SectionBuffer& lp) 
             {
 
                 lp.push("");//blank line....don't use cout !!! it might break the allignment
@@ -1320,7 +1337,7 @@ int main(){
                         << "Network Name              " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "name_value_color", "white")
-                        << net.get_network_name() << r;
+                        << net->get_network_name() << r;
                     lp.push(ss.str());
                 }
 
@@ -1332,7 +1349,7 @@ int main(){
                         << "Network Type              " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "type_value_color", "white")
-                        << c_net.get_network_type() << r;
+                        << c_net->get_network_type() << r;
                     lp.push(ss.str());
                 }
 
@@ -1344,7 +1361,7 @@ int main(){
                         << "Local IP                  " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "local_ip_color", "white")
-                        << net.get_local_ip() << r;
+                        << net->get_local_ip() << r;
                     lp.push(ss.str());
                 }
 
@@ -1356,7 +1373,7 @@ int main(){
                         << "Public IP:                " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "public_ip_color", "white")
-                        << net.get_public_ip() << r;
+                        << net->get_public_ip() << r;
                     lp.push(ss.str());
                 }
 
@@ -1368,7 +1385,7 @@ int main(){
                         << "Locale                    " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "locale_value_color", "white")
-                        << net.get_locale() << r;
+                        << net->get_locale() << r;
                     lp.push(ss.str());
                 }
 
@@ -1380,7 +1397,7 @@ int main(){
                         << "Mac address               " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "mac_value_color", "white")
-                        << net.get_mac_address() << r;
+                        << net->get_mac_address() << r;
                     lp.push(ss.str());
                 }
 
@@ -1392,7 +1409,7 @@ int main(){
                         << "avg upload speed          " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "upload_value_color", "white")
-                        << net.get_network_upload_speed() << r;
+                        << net->get_network_upload_speed() << r;
                     lp.push(ss.str());
                 }
 
@@ -1404,15 +1421,15 @@ int main(){
                         << "avg download speed        " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "download_value_color", "white")
-                        << net.get_network_download_speed() << r;
+                        << net->get_network_download_speed() << r;
                     lp.push(ss.str());
                 }
-            }
+            });
 
        
         
             // Network Info (Compact + Extra) (dummy)
-            if (isEnabled("dummy_network_info")) {
+            if (isEnabled("dummy_network_info")) scheduler.add("dummy_network_info", [&](SectionBuffer& lp) {
 
                 lp.push("");//blank line....don't use cout !!! it might break the allignment
 
@@ -1446,7 +1463,7 @@ int main(){
                         << "Network Type              " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "type_value_color", "white")
-                        << c_net.get_network_type() << r;
+                        << c_net->get_network_type() << r;
                     lp.push(ss.str());
                 }
 
@@ -1482,7 +1499,7 @@ int main(){
                         << "Locale                    " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "locale_value_color", "white")
-                        << net.get_locale() << r;
+                        << net->get_locale() << r;
                     lp.push(ss.str());
                 }
 
@@ -1506,7 +1523,7 @@ int main(){
                         << "avg upload speed          " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "upload_value_color", "white")
-                        << net.get_network_upload_speed() << r;
+                        << net->get_network_upload_speed() << r;
                     lp.push(ss.str());
                 }
 
@@ -1518,10 +1535,10 @@ int main(){
                         << "avg download speed        " << r
                         << getColor("network_info", ":", "white") << ": " << r
                         << getColor("network_info", "download_value_color", "white")
-                        << net.get_network_download_speed() << r;
+                        << net->get_network_download_speed() << r;
                     lp.push(ss.str());
                 }
-            }
+            });
 
 
         
@@ -1530,7 +1547,7 @@ int main(){
         // end of the detailed network section////////////////////////////////////////////////
 
         // OS Info (JSON Driven)
-        if (isEnabled("os_info")) {
+        if (isEnabled("os_info")) scheduler.add("os_info", [&](SectionBuffer& lp) {
             lp.push("");
 
             // Header
@@ -1549,7 +1566,7 @@ int main(){
                 ss << getColor("os_info", "~", "white") << "~ " << r
                     << getColor("os_info", "name_label_color", "white") << "Name                      " << r
                     << getColor("os_info", ":", "white") << ": " << r
-                    << getColor("os_info", "name_value_color", "white") << os.GetOSName() << r;
+                    << getColor("os_info", "name_value_color", "white") << os->GetOSName() << r;
                 lp.push(ss.str());
             }
 
@@ -1559,7 +1576,7 @@ int main(){
                 ss << getColor("os_info", "~", "white") << "~ " << r
                     << getColor("os_info", "build_label_color", "white") << "Build                     " << r
                     << getColor("os_info", ":", "white") << ": " << r
-                    << getColor("os_info", "build_value_color", "white") << os.GetOSVersion() << r;
+                    << getColor("os_info", "build_value_color", "white") << os->GetOSVersion() << r;
                 lp.push(ss.str());
             }
 
@@ -1569,7 +1586,7 @@ int main(){
                 ss << getColor("os_info", "~", "white") << "~ " << r
                     << getColor("os_info", "arch_label_color", "white") << "Architecture              " << r
                     << getColor("os_info", ":", "white") << ": " << r
-                    << getColor("os_info", "arch_value_color", "white") << os.GetOSArchitecture() << r;
+                    << getColor("os_info", "arch_value_color", "white") << os->GetOSArchitecture() << r;
                 lp.push(ss.str());
             }
 
@@ -1579,7 +1596,7 @@ int main(){
                 ss << getColor("os_info", "~", "white") << "~ " << r
                     << getColor("os_info", "kernel_label_color", "white") << "Kernel                    " << r
                     << getColor("os_info", ":", "white") << ": " << r
-                    << getColor("os_info", "kernel_value_color", "white") << os.get_os_kernel_info() << r;
+                    << getColor("os_info", "kernel_value_color", "white") << os->get_os_kernel_info() << r;
                 lp.push(ss.str());
             }
 
@@ -1589,7 +1606,7 @@ int main(){
                 ss << getColor("os_info", "~", "white") << "~ " << r
                     << getColor("os_info", "uptime_label_color", "white") << "Uptime                    " << r
                     << getColor("os_info", ":", "white") << ": " << r
-                    << getColor("os_info", "uptime_value_color", "white") << os.get_os_uptime() << r;
+                    << getColor("os_info", "uptime_value_color", "white") << os->get_os_uptime() << r;
                 lp.push(ss.str());
             }
 
@@ -1600,7 +1617,7 @@ int main(){
                     << getColor("os_info", "install_date_label_color", "white") << "Install Date              " << r
                     << getColor("os_info", ":", "white") << ": " << r
                     << getColor("os_info", "install_date_value_color", "white")
-                    << os.get_os_install_date() << r;
+                    << os->get_os_install_date() << r;
                 lp.push(ss.str());
             }
 
@@ -1611,16 +1628,16 @@ int main(){
                     << getColor("os_info", "serial_label_color", "white") << "Serial                    " << r
                     << getColor("os_info", ":", "white") << ": " << r
                     << getColor("os_info", "serial_value_color", "white")
-                    << os.get_os_serial_number() << r;
+                    << os->get_os_serial_number() << r;
                 lp.push(ss.str());
             }
-        }
+        });
 
         //end of the OS info section////////////////////////////////////////////////
 
 
         // CPU Info (JSON Driven)
-        if (isEnabled("cpu_info")) {
+        if (isEnabled("cpu_info")) scheduler.add("cpu_info", [&](SectionBuffer& lp) {
             lp.push("");
 
             // Header
@@ -1639,7 +1656,7 @@ int main(){
                 ss << getColor("cpu_info", "~", "white") << "~ " << r
                     << getColor("cpu_info", "brand_label_color", "white") << "Brand                     " << r
                     << getColor("cpu_info", ":", "white") << ": " << r
-                    << getColor("cpu_info", "brand_value_color", "white") << cpu.get_cpu_info() << r;
+                    << getColor("cpu_info", "brand_value_color", "white") << cpu->get_cpu_info() << r;
                 lp.push(ss.str());
             }
 
@@ -1649,7 +1666,7 @@ int main(){
                 ss << getColor("cpu_info", "~", "white") << "~ " << r
                     << getColor("cpu_info", "utilization_label_color", "white") << "Utilization               " << r
                     << getColor("cpu_info", ":", "white") << ": " << r
-                    << getColor("cpu_info", "utilization_value_color", "white") << cpu.get_cpu_utilization() << r
+                    << getColor("cpu_info", "utilization_value_color", "white") << cpu->get_cpu_utilization() << r
                     << getColor("cpu_info", "%", "white") << "%" << r;
                 lp.push(ss.str());
             }
@@ -1660,7 +1677,7 @@ int main(){
                 ss << getColor("cpu_info", "~", "white") << "~ " << r
                     << getColor("cpu_info", "speed_label_color", "white") << "Speed                     " << r
                     << getColor("cpu_info", ":", "white") << ": " << r
-                    << getColor("cpu_info", "speed_value_color", "white") << cpu.get_cpu_speed() << r;
+                    << getColor("cpu_info", "speed_value_color", "white") << cpu->get_cpu_speed() << r;
                 lp.push(ss.str());
             }
 
@@ -1670,7 +1687,7 @@ int main(){
                 ss << getColor("cpu_info", "~", "white") << "~ " << r
                     << getColor("cpu_info", "base_speed_label_color", "white") << "Base Speed                " << r
                     << getColor("cpu_info", ":", "white") << ": " << r
-                    << getColor("cpu_info", "base_speed_value_color", "white") << cpu.get_cpu_base_speed() << r;
+                    << getColor("cpu_info", "base_speed_value_color", "white") << cpu->get_cpu_base_speed() << r;
                 lp.push(ss.str());
             }
 
@@ -1680,7 +1697,7 @@ int main(){
                 ss << getColor("cpu_info", "~", "white") << "~ " << r
                     << getColor("cpu_info", "cores_label_color", "white") << "Cores                     " << r
                     << getColor("cpu_info", ":", "white") << ": " << r
-                    << getColor("cpu_info", "cores_value_color", "white") << cpu.get_cpu_cores() << r;
+                    << getColor("cpu_info", "cores_value_color", "white") << cpu->get_cpu_cores() << r;
                 lp.push(ss.str());
             }
 
@@ -1690,7 +1707,7 @@ int main(){
                 ss << getColor("cpu_info", "~", "white") << "~ " << r
                     << getColor("cpu_info", "logical_processors_label_color", "white") << "Logical Processors        " << r
                     << getColor("cpu_info", ":", "white") << ": " << r
-                    << getColor("cpu_info", "logical_processors_value_color", "white") << cpu.get_cpu_logical_processors() << r;
+                    << getColor("cpu_info", "logical_processors_value_color", "white") << cpu->get_cpu_logical_processors() << r;
                 lp.push(ss.str());
             }
 
@@ -1700,7 +1717,7 @@ int main(){
                 ss << getColor("cpu_info", "~", "white") << "~ " << r
                     << getColor("cpu_info", "sockets_label_color", "white") << "Sockets                   " << r
                     << getColor("cpu_info", ":", "white") << ": " << r
-                    << getColor("cpu_info", "sockets_value_color", "white") << cpu.get_cpu_sockets() << r;
+                    << getColor("cpu_info", "sockets_value_color", "white") << cpu->get_cpu_sockets() << r;
                 lp.push(ss.str());
             }
 
@@ -1710,7 +1727,7 @@ int main(){
                 ss << getColor("cpu_info", "~", "white") << "~ " << r
                     << getColor("cpu_info", "virtualization_label_color", "white") << "Virtualization            " << r
                     << getColor("cpu_info", ":", "white") << ": " << r
-                    << getColor("cpu_info", "virtualization_value_color", "white") << cpu.get_cpu_virtualization() << r;
+                    << getColor("cpu_info", "virtualization_value_color", "white") << cpu->get_cpu_virtualization() << r;
                 lp.push(ss.str());
             }
 
@@ -1720,7 +1737,7 @@ int main(){
                 ss << getColor("cpu_info", "~", "white") << "~ " << r
                     << getColor("cpu_info", "l1_cache_label_color", "white") << "L1 Cache                  " << r
                     << getColor("cpu_info", ":", "white") << ": " << r
-                    << getColor("cpu_info", "l1_cache_value_color", "white") << cpu.get_cpu_l1_cache() << r;
+                    << getColor("cpu_info", "l1_cache_value_color", "white") << cpu->get_cpu_l1_cache() << r;
                 lp.push(ss.str());
             }
 
@@ -1730,7 +1747,7 @@ int main(){
                 ss << getColor("cpu_info", "~", "white") << "~ " << r
                     << getColor("cpu_info", "l2_cache_label_color", "white") << "L2 Cache                  " << r
                     << getColor("cpu_info", ":", "white") << ": " << r
-                    << getColor("cpu_info", "l2_cache_value_color", "white") << cpu.get_cpu_l2_cache() << r;
+                    << getColor("cpu_info", "l2_cache_value_color", "white") << cpu->get_cpu_l2_cache() << r;
                 lp.push(ss.str());
             }
 
@@ -1740,18 +1757,18 @@ int main(){
                 ss << getColor("cpu_info", "~", "white") << "~ " << r
                     << getColor("cpu_info", "l3_cache_label_color", "white") << "L3 Cache                  " << r
                     << getColor("cpu_info", ":", "white") << ": " << r
-                    << getColor("cpu_info", "l3_cache_value_color", "white") << cpu.get_cpu_l3_cache() << r;
+                    << getColor("cpu_info", "l3_cache_value_color", "white") << cpu->get_cpu_l3_cache() << r;
                 lp.push(ss.str());
             }
-        }
+        });
 
         //end of the CPU info section////////////////////////////////////////////////
  
 
         // GPU Info (JSON Driven)
-        if (isEnabled("gpu_info")) {
+        if (isEnabled("gpu_info")) scheduler.add("gpu_info", "gpu", [&](SectionBuffer& lp) {
             lp.push("");
-            auto all_gpu_info = obj_gpu.get_all_gpu_info();
+            auto all_gpu_info = obj_gpu->get_all_gpu_info();
 
             if (all_gpu_info.empty()) {
                 if (isSubEnabled("gpu_info", "show_header")) {
@@ -1863,7 +1880,7 @@ int main(){
                 }
 
                 // Primary GPU Details
-                auto primary = detailed_gpu_info.primary_gpu_info();
+                auto primary = detailed_gpu_info->primary_gpu_info();
                 if (isSubEnabled("gpu_info", "show_primary_details")) {
                     lp.push("");
                     ostringstream ss;
@@ -1904,14 +1921,14 @@ int main(){
                     }
                 }
             }
-        }
+        });
 		// end of the GPU info section////////////////////////////////////////////////
          
         // ================= DISPLAY INFO (FULLY JSON DRIVEN) =================
-        if (isEnabled("display_info")) {
+        if (isEnabled("display_info")) scheduler.add("display_info", "gpu", [&](SectionBuffer& lp) {
             lp.push("");
 
-            const auto& screens = di.getScreens();
+            const auto& screens = di->getScreens();
 
             for (size_t i = 0; i < screens.size(); ++i) {
                 const auto& s = screens[i];
@@ -2027,14 +2044,14 @@ int main(){
 
                 lp.push("");
             }
-        }
+        });
 
 
 
         //END of gpu section/////////////////////////////////////////////////////////////////
 
         // BIOS & Motherboard Info (JSON Driven)
-        if (isEnabled("bios_mb_info")) {
+        if (isEnabled("bios_mb_info")) scheduler.add("bios_mb_info", [&](SectionBuffer& lp) {
             lp.push("");
 
             // Header
@@ -2053,7 +2070,7 @@ int main(){
                 ss << getColor("bios_mb_info", "~", "white") << "~ " << r
                     << getColor("bios_mb_info", "vendor_label_color", "white") << "Bios Vendor              " << r
                     << getColor("bios_mb_info", ":", "white") << ": " << r
-                    << getColor("bios_mb_info", "vendor_value_color", "white") << sys.get_bios_vendor() << r;
+                    << getColor("bios_mb_info", "vendor_value_color", "white") << sys->get_bios_vendor() << r;
                 lp.push(ss.str());
             }
 
@@ -2063,7 +2080,7 @@ int main(){
                 ss << getColor("bios_mb_info", "~", "white") << "~ " << r
                     << getColor("bios_mb_info", "version_label_color", "white") << "Bios Version             " << r
                     << getColor("bios_mb_info", ":", "white") << ": " << r
-                    << getColor("bios_mb_info", "version_value_color", "white") << sys.get_bios_version() << r;
+                    << getColor("bios_mb_info", "version_value_color", "white") << sys->get_bios_version() << r;
                 lp.push(ss.str());
             }
 
@@ -2073,7 +2090,7 @@ int main(){
                 ss << getColor("bios_mb_info", "~", "white") << "~ " << r
                     << getColor("bios_mb_info", "date_label_color", "white") << "Bios Date                " << r
                     << getColor("bios_mb_info", ":", "white") << ": " << r
-                    << getColor("bios_mb_info", "date_value_color", "white") << sys.get_bios_date() << r;
+                    << getColor("bios_mb_info", "date_value_color", "white") << sys->get_bios_date() << r;
                 lp.push(ss.str());
             }
 
@@ -2083,7 +2100,7 @@ int main(){
                 ss << getColor("bios_mb_info", "~", "white") << "~ " << r
                     << getColor("bios_mb_info", "model_label_color", "white") << "Motherboard Model        " << r
                     << getColor("bios_mb_info", ":", "white") << ": " << r
-                    << getColor("bios_mb_info", "model_value_color", "white") << sys.get_motherboard_model() << r;
+                    << getColor("bios_mb_info", "model_value_color", "white") << sys->get_motherboard_model() << r;
                 lp.push(ss.str());
             }
 
@@ -2093,15 +2110,15 @@ int main(){
                 ss << getColor("bios_mb_info", "~", "white") << "~ " << r
                     << getColor("bios_mb_info", "mfg_label_color", "white") << "Motherboard Manufacturer " << r
                     << getColor("bios_mb_info", ":", "white") << ": " << r
-                    << getColor("bios_mb_info", "mfg_value_color", "white") << sys.get_motherboard_manufacturer() << r;
+                    << getColor("bios_mb_info", "mfg_value_color", "white") << sys->get_motherboard_manufacturer() << r;
                 lp.push(ss.str());
             }
-        }
+        });
 
 		//end of the BIOS & Motherboard info section///////////////////////////////
 
         // User Info (JSON Driven)
-        if (isEnabled("user_info")) {
+        if (isEnabled("user_info")) scheduler.add("user_info", [&](SectionBuffer& lp) {
             lp.push("");
 
             // Header
@@ -2120,7 +2137,7 @@ int main(){
                 ss << getColor("user_info", "~", "white") << "~ " << r
                     << getColor("user_info", "username_label_color", "white") << "Username                 " << r
                     << getColor("user_info", ":", "white") << ": " << r
-                    << getColor("user_info", "username_value_color", "white") << user.get_username() << r;
+                    << getColor("user_info", "username_value_color", "white") << user->get_username() << r;
                 lp.push(ss.str());
             }
 
@@ -2130,7 +2147,7 @@ int main(){
                 ss << getColor("user_info", "~", "white") << "~ " << r
                     << getColor("user_info", "computer_name_label_color", "white") << "Computer Name            " << r
                     << getColor("user_info", ":", "white") << ": " << r
-                    << getColor("user_info", "computer_name_value_color", "white") << user.get_computer_name() << r;
+                    << getColor("user_info", "computer_name_value_color", "white") << user->get_computer_name() << r;
                 lp.push(ss.str());
             }
 
@@ -2140,15 +2157,15 @@ int main(){
                 ss << getColor("user_info", "~", "white") << "~ " << r
                     << getColor("user_info", "domain_label_color", "white") << "Domain                   " << r
                     << getColor("user_info", ":", "white") << ": " << r
-                    << getColor("user_info", "domain_value_color", "white") << user.get_domain_name() << r;
+                    << getColor("user_info", "domain_value_color", "white") << user->get_domain_name() << r;
                 lp.push(ss.str());
             }
-        }
+        });
 
 		// end of the User info section////////////////////////////////////////////////
 
         // Performance Info (JSON Driven)
-        if (isEnabled("performance_info")) {
+        if (isEnabled("performance_info")) scheduler.add("performance_info", "gpu", [&](SectionBuffer& lp) {
             lp.push("");
 
             // Header
@@ -2167,7 +2184,7 @@ int main(){
                 ss << getColor("performance_info", "~", "white") << "~ " << r
                     << getColor("performance_info", "uptime_label_color", "white") << "System Uptime            " << r
                     << getColor("performance_info", ":", "white") << ": " << r
-                    << getColor("performance_info", "uptime_value_color", "white") << perf.get_system_uptime() << r;
+                    << getColor("performance_info", "uptime_value_color", "white") << perf->get_system_uptime() << r;
                 lp.push(ss.str());
             }
 
@@ -2177,18 +2194,54 @@ int main(){
                 ss << getColor("performance_info", "~", "white") << "~ " << r
                     << getColor("performance_info", "cpu_usage_label_color", "white") << "CPU Usage                " << r
                     << getColor("performance_info", ":", "white") << ": " << r
-                    << getColor("performance_info", "usage_value_color", "white") << perf.get_cpu_usage_percent() << r
+                    << getColor("performance_info", "usage_value_color", "white") << perf->get_cpu_usage_percent() << r
                     << getColor("performance_info", "%", "white") << "%" << r;
                 lp.push(ss.str());
             }
 
+            // Per-core CPU Usage (opt-in): wrapped so no row runs past the
+            // console next to the art, continuation rows line up under the values
+            if (isSubEnabled("performance_info", "show_cpu_core_usage")) {
+                vector<float> cores = perf->get_cpu_core_usage_percent();
+                if (!cores.empty()) {
+                    const int labelWidth = 29;      // "~ CPU Core Usage           : "
+                    const int cellWidth = 5;        // "100% "
+                    size_t perRow = 16;             // not a console (redirected): fixed rows
+                    CONSOLE_SCREEN_BUFFER_INFO screen;
+                    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &screen)) {
+                        int infoWidth = screen.srWindow.Right - screen.srWindow.Left + 1
+                            - art.getMaxWidth() - art.getSpacing();   // the padding LivePrinter puts in front
+                        int fit = (infoWidth - labelWidth) / cellWidth;
+                        perRow = fit > 0 ? static_cast<size_t>(fit) : 1;
+                    }
+
+                    for (size_t first = 0; first < cores.size(); first += perRow) {
+                        ostringstream ss;
+                        if (first == 0) {
+                            ss << getColor("performance_info", "~", "white") << "~ " << r
+                                << getColor("performance_info", "cpu_core_usage_label_color", "white") << "CPU Core Usage           " << r
+                                << getColor("performance_info", ":", "white") << ": " << r;
+                        }
+                        else {
+                            ss << string(labelWidth, ' ');
+                        }
+                        for (size_t i = first; i < cores.size() && i < first + perRow; ++i) {
+                            if (i > first) ss << " ";
+                            ss << getColor("performance_info", "usage_value_color", "white") << static_cast<int>(cores[i] + 0.5f) << r
+                                << getColor("performance_info", "%", "white") << "%" << r;
+                        }
+                        lp.push(ss.str());
+                    }
+                }
+            }
+
             // RAM Usage
             if (isSubEnabled("performance_info", "show_ram_usage")) {
                 ostringstream ss;
                 ss << getColor("performance_info", "~", "white") << "~ " << r
                     << getColor("performance_info", "ram_usage_label_color", "white") << "RAM Usage                " << r
                     << getColor("performance_info", ":", "white") << ": " << r
-                    << getColor("performance_info", "usage_value_color", "white") << perf.get_ram_usage_percent() << r
+                    << getColor("performance_info", "usage_value_color", "white") << perf->get_ram_usage_percent() << r
                     << getColor("performance_info", "%", "white") << "%" << r;
                 lp.push(ss.str());
             }
@@ -2199,7 +2252,8 @@ int main(){
                 ss << getColor("performance_info", "~", "white") << "~ " << r
                     << getColor("performance_info", "disk_usage_label_color", "white") << "Disk Usage               " << r
                     << getColor("performance_info", ":", "white") << ": " << r
-                    << getColor("performance_info", "usage_value_color", "white") << perf.get_disk_usage_percent() << r
+                    << getColor("performance_info", "usage_value_color", "white")
+                    << (cfg.text({ "performance_info", "disk_usage_mode" }, "space") == "busy" ? perf->get_disk_busy_percent() : perf->get_disk_usage_percent()) << r
                     << getColor("performance_info", "%", "white") << "%" << r;
                 lp.push(ss.str());
             }
@@ -2210,17 +2264,17 @@ int main(){
                 ss << getColor("performance_info", "~", "white") << "~ " << r
                     << getColor("performance_info", "gpu_usage_label_color", "white") << "GPU Usage                " << r
                     << getColor("performance_info", ":", "white") << ": " << r
-                    << getColor("performance_info", "usage_value_color", "white") << perf.get_gpu_usage_percent() << r
+                    << getColor("performance_info", "usage_value_color", "white") << perf->get_gpu_usage_percent() << r
                     << getColor("performance_info", "%", "white") << "%" << r;
                 lp.push(ss.str());
             }
-        }
+        });
 
 		// end of the Performance info section////////////////////////////////////////
 
  
         // Audio & Power Info (JSON Driven)
-        if (isEnabled("audio_power_info")) {
+        if (isEnabled("audio_power_info")) scheduler.add("audio_power_info", [&](SectionBuffer& lp) {
             lp.push("");
             ExtraInfo audio;
 
@@ -2312,7 +2366,7 @@ int main(){
                 }
                 lp.push(ossPower.str());
             }
-        }
+        });
 
 
         /*
@@ -2366,11 +2420,93 @@ int main(){
 
     // ---------------- End of info lines ----------------
 
+    // Stream every queued section in order (waits for the slow ones)
+    scheduler.run();
+
     // Print remaining ASCII art lines (if art is taller than info)
     lp.finish();
 
+    // ========== WATCH MODE ==========
+    // The modules, the worker pool, the PDH query and the NVAPI handle all
+    // stay alive; each tick re-collects the repeating sections and repaints
+    // only the cells that changed (see LivePrinter::repaint). Between ticks
+    // the process just waits, so it can sit in a terminal pane all day.
+    size_t watchTicks = 0, watchCells = 0;
+    if (watch) {
+        HANDLE console = GetStdHandle(STD_OUTPUT_HANDLE);
+        DWORD consoleMode = 0;
+        bool restoreMode = GetConsoleMode(console, &consoleMode) != 0;
+        if (restoreMode) SetConsoleMode(console, consoleMode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+
+        watchStop = CreateEventA(NULL, TRUE, FALSE, NULL);
+        SetConsoleCtrlHandler(onWatchStop, TRUE);
+        cout << "\033[?25l\033[?7l" << flush; // hide the cursor, no wrapping: one line = one row
+
+        vector<string> frameLines;
+        auto nextTick = chrono::steady_clock::now();
+        while (true) {
+            nextTick += chrono::milliseconds(watchMs);
+            auto now = chrono::steady_clock::now();
+            if (nextTick < now) nextTick = now; // a slow tick doesn't trigger a burst
+            DWORD waitMs = static_cast<DWORD>(chrono::duration_cast<chrono::milliseconds>(nextTick - now).count());
+            if (WaitForSingleObject(watchStop, waitMs) != WAIT_TIMEOUT) break;
+
+            UtilizationSampler::instance().nextWindow();
+            FactStore::instance().expireVolatile();
+            scheduler.tick(frameLines);
+
+            CONSOLE_SCREEN_BUFFER_INFO screen;
+            int screenRows = GetConsoleScreenBufferInfo(console, &screen) ? screen.srWindow.Bottom - screen.srWindow.Top + 1 : 0;
+            watchCells += lp.repaint(frameLines, screenRows);
+            ++watchTicks;
+        }
+
+        cout << "\033[?7h\033[?25h" << flush;
+        SetConsoleCtrlHandler(onWatchStop, FALSE);
+        CloseHandle(watchStop);
+        if (restoreMode) SetConsoleMode(console, consoleMode);
+        scheduler.stop();
+    }
+
     cout << endl;
 
+    if (staticCacheEnabled) StaticCache::instance().save();
+    if (benchCacheEnabled) BenchmarkCache::instance().save();
+
+    if (showStats) {
+        FactStore& facts = FactStore::instance();
+        cout << "Fact store:" << endl;
+        for (size_t i = 0; i < static_cast<size_t>(FactId::Count); ++i) {
+            FactId id = static_cast<FactId>(i);
+            cout << "  " << left << setw(14) << FactStore::name(id)
+                << " hits " << setw(4) << facts.hits(id)
+                << " misses " << facts.misses(id) << endl;
+        }
+        if (staticCacheEnabled) {
+            cout << "Static cache: " << (StaticCache::instance().isWarm() ? "warm" : "cold") << endl;
+        }
+        cout << "Output: " << outputMode << ", " << lp.writeCount() << " writes, "
+            << lp.bytesWritten() << " bytes" << endl;
+        cout << "Config: " << (cfg.isSnapshot() ? "snapshot" : "parsed") << ", " << cfg.size() << " keys, "
+            << cfg.lookups() << " lookups" << endl;
+        if (watch) {
+            cout << "Watch: " << watchTicks << " ticks every " << watchMs << " ms, " << watchCells
+                << " cells repainted" << endl;
+        }
+        if (artLibrary.size() > 0) {
+            cout << "Art library: " << (artLibrary.isIndexed() ? "index" : "parsed") << ", " << artLibrary.size()
+                << " arts, showing " << (libraryArt < 0 ? string("BinaryArt.txt") : "#" + to_string(libraryArt + 1) +
+                    (artLibrary.name(libraryArt).empty() ? "" : " " + artLibrary.name(libraryArt))) << endl;
+        }
+    }
+
+    // A section that blew its deadline is still stuck somewhere (a WMI call,
+    // a hung mount...). It can't be cancelled and it still references objects
+    // on this stack, so leave right here instead of unwinding main().
+    if (scheduler.detached()) {
+        cout.flush();
+        _exit(0);
+    }
 
 
 
@@ -2465,6 +2601,8 @@ A. CONFIG FILE LOCATIONS:
    2. Production Mode (LOAD_DEFAULT_CONFIG=false):
       - User config: C:\Users\Public\BinaryFetch\BinaryFetch_Config.json
       - Self-healing: If missing, extracts from EXE resource (IDR_DEFAULT_CONFIG=101)
+      - Compiled snapshot: BinaryFetch_Config.bin beside it, rebuilt whenever the
+        JSON changes (mtime/size, then content hash) - see ConfigIndex.h
 
 B. CONFIG STRUCTURE HIERARCHY:
    {
@@ -2797,8 +2935,8 @@ STRUCT: storage_data (passed to callback)
 - file_system - File system type
 - is_external - Boolean for external/internal
 - serial_number - Disk serial number
-- read_speed - Read speed in MB/s
-- write_speed - Write speed in MB/s
+- read_speed - Read speed in MB/s ("---" if the test failed)
+- write_speed - Write speed in MB/s ("---" unless benchmark.write is on)
 - predicted_read_speed - Predicted read speed
 - predicted_write_speed - Predicted write speed
 - storage_type - Storage type (SSD/HDD/etc)
@@ -2826,9 +2964,11 @@ OBJECT: perf
 FUNCTIONS:
 1. get_system_uptime() - Returns system uptime
 2. get_cpu_usage_percent() - Returns CPU usage percentage
-3. get_ram_usage_percent() - Returns RAM usage percentage
-4. get_disk_usage_percent() - Returns disk usage percentage
-5. get_gpu_usage_percent() - Returns GPU usage percentage
+3. get_cpu_core_usage_percent() - Returns usage percentage per logical processor
+4. get_ram_usage_percent() - Returns RAM usage percentage
+5. get_disk_usage_percent() - Returns disk usage percentage (space used on C:)
+6. get_disk_busy_percent() - Returns physical disk busy time percentage
+7. get_gpu_usage_percent() - Returns GPU usage percentage
 
 CLASS: DisplayInfo
 OBJECT: di
@@ -2949,7 +3089,8 @@ FUNCTIONS:
 1. getCPUUsage() - Returns CPU usage percentage
 2. getGPUUsage() - Returns GPU usage percentage
 3. getRAMUsage() - Returns RAM usage percentage
-4. getDiskUsage() - Returns disk usage percentage
+4. getDiskUsage() - Returns disk usage percentage (space used on C:)
+5. getDiskBusy() - Returns physical disk busy time percentage
 
 CLASS: CompactUser
 OBJECT: c_user
@@ -0,0 +1,90 @@
+/*
+================================================================================
+ main_linux.cpp — minimal Linux front end
+================================================================================
+
+main.cpp (config, templates, the section scheduler, --watch) is Windows only.
+Until it is ported, this prints one fixed set of lines from the collectors
+that have a Linux backend, next to the ASCII art:
+
+    Uptime     CPUInfo (/proc/uptime)
+    CPU        CPUInfo (/proc/cpuinfo, /sys/devices/system/cpu)
+    Memory     MemoryInfo (/proc/meminfo; modules from the SMBIOS tables,
+               which only root can read)
+    Board/BIOS SystemInfo (SMBIOS, else /sys/class/dmi/id)
+    GPU        GPUInfo (/sys/class/drm), one line per card
+    Display    DisplayInfo (DRM connectors + EDID), one line per screen
+    Disk       StorageInfo (mountinfo, statvfs, read speed test)
+    Network    CompactNetwork (netlink)
+
+No config file, no colors beyond the labels, no options: it is a preview of
+the Linux port, not the Linux version of BinaryFetch.
+
+    binaryfetch
+================================================================================
+*/
+#include "include/AsciiArt.h"
+#include "include/CPUInfo.h"
+#include "include/MemoryInfo.h"
+#include "include/SystemInfo.h"
+#include "include/GPUInfo.h"
+#include "include/DisplayInfo.h"
+#include "include/StorageInfo.h"
+#include "include/CompactNetwork.h"
+
+#include <string>
+#include <vector>
+using namespace std;
+
+static string line(const string& label, const string& value) {
+    return "\033[1;34m" + label + "\033[0m: " + value;
+}
+
+int main() {
+    AsciiArt art;
+    art.loadFromFile();   // ~/.config/BinaryFetch/BinaryArt.txt; without it: info lines only
+    LivePrinter lp(art);
+
+    CPUInfo cpu;
+    lp.push(line("Uptime", cpu.get_system_uptime()));
+    lp.push(line("CPU", cpu.get_cpu_info() + " (" + to_string(cpu.get_cpu_cores()) + " cores, " +
+        to_string(cpu.get_cpu_logical_processors()) + " threads) @ " + cpu.get_cpu_speed()));
+
+    MemoryInfo memory;
+    lp.push(line("Memory", to_string(memory.getTotal() - memory.getFree()) + " / " + to_string(memory.getTotal()) +
+        " GB (" + to_string(memory.getUsedPercentage()) + "%)"));
+    for (const MemoryModule& m : memory.getModules()) {
+        lp.push(line("Memory", m.capacity + " " + m.type + " " + m.speed));
+    }
+
+    SystemInfo sys;
+    lp.push(line("Board", sys.get_motherboard_manufacturer() + " " + sys.get_motherboard_model()));
+    lp.push(line("BIOS", sys.get_bios_vendor() + " " + sys.get_bios_version() + " (" + sys.get_bios_date() + ")"));
+
+    for (const gpu_data& gpu : GPUInfo::get_all_gpu_info()) {
+        string value = gpu.gpu_name;
+        if (!gpu.gpu_memory.empty()) value += ", " + gpu.gpu_memory;
+        if (!gpu.gpu_driver_version.empty()) value += ", driver " + gpu.gpu_driver_version;
+        lp.push(line("GPU", value));
+    }
+
+    DisplayInfo display;
+    for (const DisplayInfo::ScreenInfo& screen : display.getScreens()) {
+        string value = screen.name + " " + to_string(screen.current_width) + "x" + to_string(screen.current_height);
+        if (screen.refresh_rate > 0) value += " @ " + to_string(screen.refresh_rate) + " Hz";
+        lp.push(line("Display", value));
+    }
+
+    StorageInfo storage;
+    storage.process_storage_info([&](const storage_data& disk) {
+        lp.push(line(disk.drive_letter, disk.used_space + " / " + disk.total_space + " GiB (" +
+            to_string(disk.used_percentage) + "%) " + disk.file_system + " " + disk.storage_type +
+            ", read " + disk.read_speed + " MB/s"));
+    });
+
+    CompactNetwork network;
+    lp.push(line("Network", network.get_network_name() + " (" + network.get_network_type() + ") " + network.get_network_ip()));
+
+    lp.finish();
+    return 0;
+}
@@ -0,0 +1,31 @@
+/*
+================================================================================
+ alloc_count.cpp — counting operator new for the benchmarks
+================================================================================
+
+Linked into a benchmark target, it replaces the global operator new / delete
+of that program only; alloc_count() is the number of allocations so far.
+Kept out of the benchmark source so the compiler can't inline free() into
+code that allocated through new (gcc then warns about a mismatch).
+================================================================================
+*/
+#include <cstdlib>
+#include <new>
+using namespace std;
+
+static size_t allocations = 0;
+
+size_t alloc_count() {
+    return allocations;
+}
+
+void* operator new(size_t size) {
+    ++allocations;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
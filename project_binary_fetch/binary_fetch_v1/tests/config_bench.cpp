@@ -0,0 +1,250 @@
+/*
+================================================================================
+ config_bench.cpp — config lookups and allocations, json walk vs. ConfigIndex
+================================================================================
+
+Asks the default config every question the section renderers can ask it:
+
+    section flag     "cpu.show_cores"                    isSubEnabled
+    section color    "cpu.colors.label"                  getColor
+    nested flag      "compact_time.time_section.show_hour"
+                                                         isNestedEnabled
+    storage path     "detailed_storage.a.b.c" (any depth) getNestedBool /
+                                                         getNestedColor
+
+once through the nlohmann::json helpers main.cpp used before ConfigIndex
+(kept below as the reference) and once through ConfigIndex. Every answer has
+to match. For both it prints time, lookups and heap allocations per pass;
+allocations are counted by the operator new of alloc_count.cpp, linked into
+this target only.
+
+    cmake -S . -B build -DCMAKE_BUILD_TYPE=Release
+    cmake --build build --target config_bench
+    build/config_bench [config json]
+================================================================================
+*/
+#include "include/ConfigIndex.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace std;
+using json = nlohmann::json;
+
+// allocations so far (alloc_count.cpp)
+size_t alloc_count();
+
+// -------------------- Json reference (main.cpp before ConfigIndex) --------------------
+
+static const map<string, string> colors = {
+    {"red", "\033[31m"}, {"green", "\033[32m"}, {"yellow", "\033[33m"},
+    {"blue", "\033[34m"}, {"magenta", "\033[35m"}, {"cyan", "\033[36m"},
+    {"white", "\033[37m"}, {"bright_red", "\033[91m"}, {"bright_green", "\033[92m"},
+    {"bright_yellow", "\033[93m"}, {"bright_blue", "\033[94m"},
+    {"bright_magenta", "\033[95m"}, {"bright_cyan", "\033[96m"},
+    {"bright_white", "\033[97m"}, {"reset", "\033[0m"}
+};
+
+static json config;
+static size_t jsonLookups = 0;
+
+static string getColor(const string& section, const string& key, const string& defaultColor = "white") {
+    ++jsonLookups;
+    if (!config.contains(section)) return colors.at(defaultColor);
+    if (config[section].contains("colors") && config[section]["colors"].contains(key)) {
+        string colorName = config[section]["colors"][key].get<string>();
+        return colors.count(colorName) ? colors.at(colorName) : colors.at(defaultColor);
+    }
+    if (config[section].contains(key)) {
+        string colorName = config[section][key].get<string>();
+        return colors.count(colorName) ? colors.at(colorName) : colors.at(defaultColor);
+    }
+    return colors.at(defaultColor);
+}
+
+static bool isSubEnabled(const string& section, const string& key) {
+    ++jsonLookups;
+    if (!config.contains(section)) return true;
+    return config[section].value(key, true);
+}
+
+static bool isNestedEnabled(const string& module, const string& section, const string& key) {
+    ++jsonLookups;
+    if (!config.contains(module)) return true;
+    if (!config[module].contains(section)) return true;
+    return config[module][section].value(key, true);
+}
+
+// getNestedBool / getNestedColor: dotted path below "detailed_storage"
+static json storageNode(const string& path, bool& found) {
+    vector<string> keys;
+    stringstream ss(path);
+    string key;
+    while (getline(ss, key, '.')) keys.push_back(key);
+
+    found = false;
+    if (!config.contains("detailed_storage")) return json();
+    json current = config["detailed_storage"];
+    for (const auto& k : keys) {
+        if (!current.contains(k)) return json();
+        current = current[k];
+    }
+    found = true;
+    return current;
+}
+
+static bool getNestedBool(const string& path, bool defaultValue = true) {
+    ++jsonLookups;
+    bool found;
+    json current = storageNode(path, found);
+    return found && current.is_boolean() ? current.get<bool>() : defaultValue;
+}
+
+static string getNestedColor(const string& path, const string& defaultColor = "white") {
+    ++jsonLookups;
+    bool found;
+    json current = storageNode(path, found);
+    if (found && current.is_string()) {
+        string colorName = current.get<string>();
+        return colors.count(colorName) ? colors.at(colorName) : colors.at(defaultColor);
+    }
+    return colors.at(defaultColor);
+}
+
+// -------------------- Questions --------------------
+
+struct Question {
+    enum Kind { SectionFlag, SectionColor, NestedFlag, StorageFlag, StorageColor } kind;
+    string a, b, c;   // section / key, or section / block / key; the dotted path for storage
+};
+
+static void storage_questions(const json& node, const string& path, vector<Question>& out) {
+    for (auto it = node.begin(); it != node.end(); ++it) {
+        string p = path.empty() ? it.key() : path + "." + it.key();
+        if (it->is_object()) storage_questions(*it, p, out);
+        else if (it->is_boolean()) out.push_back({ Question::StorageFlag, p, "", "" });
+        else if (it->is_string()) out.push_back({ Question::StorageColor, p, "", "" });
+    }
+}
+
+static vector<Question> questions() {
+    vector<Question> out;
+    for (auto s = config.begin(); s != config.end(); ++s) {
+        if (!s->is_object()) continue;
+        if (s.key() == "detailed_storage") {
+            storage_questions(*s, "", out);
+            continue;
+        }
+        for (auto k = s->begin(); k != s->end(); ++k) {
+            if (k->is_boolean()) {
+                out.push_back({ Question::SectionFlag, s.key(), k.key(), "" });
+            }
+            else if (k.key() == "colors" && k->is_object()) {
+                for (auto c = k->begin(); c != k->end(); ++c) {
+                    if (c->is_string()) out.push_back({ Question::SectionColor, s.key(), c.key(), "" });
+                }
+            }
+            else if (k->is_object()) {
+                for (auto n = k->begin(); n != k->end(); ++n) {
+                    if (n->is_boolean()) out.push_back({ Question::NestedFlag, s.key(), k.key(), n.key() });
+                }
+            }
+        }
+    }
+    return out;
+}
+
+// answer as text so both sides compare the same way
+static string ask_json(const Question& q) {
+    switch (q.kind) {
+    case Question::SectionFlag:  return isSubEnabled(q.a, q.b) ? "1" : "0";
+    case Question::SectionColor: return getColor(q.a, q.b);
+    case Question::NestedFlag:   return isNestedEnabled(q.a, q.b, q.c) ? "1" : "0";
+    case Question::StorageFlag:  return getNestedBool(q.a) ? "1" : "0";
+    default:                     return getNestedColor(q.a);
+    }
+}
+
+static const string& ask_index(const ConfigIndex& cfg, const Question& q, const string& on, const string& off) {
+    switch (q.kind) {
+    case Question::SectionFlag:  return cfg.flag({ q.a, q.b }) ? on : off;
+    case Question::SectionColor: return cfg.color({ q.a, "colors", q.b }, "white");
+    case Question::NestedFlag:   return cfg.flag({ q.a, q.b, q.c }) ? on : off;
+    case Question::StorageFlag:  return cfg.flag({ "detailed_storage", q.a }) ? on : off;
+    default:                     return cfg.color({ "detailed_storage", q.a }, "white");
+    }
+}
+
+// -------------------- Timing --------------------
+
+struct PassCost {
+    double us;
+    size_t allocs;
+    size_t runs;
+};
+
+// runs pass() until 200 ms have gone by, returns the cost of one pass
+template <class Pass>
+static PassCost time_pass(Pass pass) {
+    using clock = chrono::steady_clock;
+    size_t runs = 0;
+    size_t allocsBefore = alloc_count();
+    auto start = clock::now();
+    chrono::duration<double, micro> elapsed{};
+    do {
+        pass();
+        ++runs;
+        elapsed = clock::now() - start;
+    } while (elapsed.count() < 200000.0);
+    return { elapsed.count() / static_cast<double>(runs), (alloc_count() - allocsBefore) / runs, runs };
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : CONFIG_BENCH_JSON;
+    ifstream in(path, ios::binary);
+    if (!in) {
+        printf("can't open %s\n", path);
+        return 1;
+    }
+    string text((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    config = json::parse(text);
+
+    size_t allocsBefore = alloc_count();
+    ConfigIndex cfg(colors);
+    cfg.compile(config, text);
+    size_t compileAllocs = alloc_count() - allocsBefore;
+
+    vector<Question> qs = questions();
+    const string on = "1", off = "0";
+
+    size_t mismatches = 0;
+    for (const Question& q : qs) {
+        if (ask_json(q) != ask_index(cfg, q, on, off)) {
+            printf("  differs: %s %s %s\n", q.a.c_str(), q.b.c_str(), q.c.c_str());
+            ++mismatches;
+        }
+    }
+
+    jsonLookups = 0;
+    size_t sink = 0;
+    PassCost old = time_pass([&] {
+        for (const Question& q : qs) sink += ask_json(q).size();
+        });
+    size_t oldLookups = jsonLookups / old.runs;
+
+    size_t lookupsBefore = cfg.lookups();
+    PassCost now = time_pass([&] {
+        for (const Question& q : qs) sink += ask_index(cfg, q, on, off).size();
+        });
+    size_t nowLookups = (cfg.lookups() - lookupsBefore) / now.runs;
+
+    printf("%s: %zu keys compiled (%zu allocations, once), %zu questions, %zu differ\n\n",
+        path, cfg.size(), compileAllocs, qs.size(), mismatches);
+    printf("per pass         time   lookups  allocations\n");
+    printf("  json walk   %8.1f us  %7zu  %11zu\n", old.us, oldLookups, old.allocs);
+    printf("  ConfigIndex %8.1f us  %7zu  %11zu\n", now.us, nowLookups, now.allocs);
+    return (mismatches || sink == 0) ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+/*
+================================================================================
+ text_bench.cpp — art scanners and utf8_display_width, timed
+================================================================================
+
+Loads an art collection (BinaryARTS.txt by default) and times, per pass over
+all of its lines:
+
+    colors   processColorCodes + stripAnsiSequences, against the regex code
+             they replaced (kept below as the reference)
+    width    utf8_display_width on the colored art lines, on plain ASCII
+             info lines and on CJK / emoji lines
+
+Built twice: text_bench uses the SSE2 / AVX2 ASCII path of TextWidth.cpp,
+text_bench_scalar the same file built with TEXTWIDTH_NO_SIMD. The width
+checksums of the two must match. Numbers only mean something in a release
+build:
+
+    cmake -S . -B build -DCMAKE_BUILD_TYPE=Release
+    cmake --build build --target text_bench text_bench_scalar
+    build/text_bench [art file]
+    build/text_bench_scalar [art file]
+================================================================================
+*/
+#include "include/AsciiArt.h"
+#include "include/TextWidth.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <string>
+#include <vector>
+using namespace std;
+
+#ifdef TEXTWIDTH_NO_SIMD
+static const char* VARIANT = "scalar";
+#else
+static const char* VARIANT = "simd";
+#endif
+
+// -------------------- Regex reference (AsciiArt.cpp before the scanners) --------------------
+
+static const map<int, string> regexColorMap = {
+    {1, "\033[31m"}, {2, "\033[32m"}, {3, "\033[33m"},
+    {4, "\033[34m"}, {5, "\033[35m"}, {6, "\033[36m"},
+    {7, "\033[37m"}, {8, "\033[91m"}, {9, "\033[92m"},
+    {10, "\033[93m"}, {11, "\033[94m"}, {12, "\033[95m"},
+    {13, "\033[96m"}, {14, "\033[97m"}, {15, "\033[0m"}
+};
+
+static string regexStripAnsi(const string& s) {
+    static const regex ansi_re("\x1B\\[[0-9;]*[A-Za-z]");
+    return regex_replace(s, ansi_re, "");
+}
+
+static string regexColorCodes(const string& line) {
+    regex colorCodeRegex("\\$(\\d+)");
+    smatch match;
+    string processed;
+    string remaining = line;
+
+    while (regex_search(remaining, match, colorCodeRegex)) {
+        processed += match.prefix();
+        auto it = regexColorMap.find(stoi(match[1].str()));
+        if (it != regexColorMap.end()) processed += it->second;
+        remaining = match.suffix();
+    }
+    processed += remaining + "\033[0m";
+    return processed;
+}
+
+// -------------------- Timing --------------------
+
+// runs pass() until 200 ms have gone by, returns ms per pass
+template <class Pass>
+static double time_pass(Pass pass) {
+    using clock = chrono::steady_clock;
+    size_t runs = 0;
+    auto start = clock::now();
+    chrono::duration<double, milli> elapsed{};
+    do {
+        pass();
+        ++runs;
+        elapsed = clock::now() - start;
+    } while (elapsed.count() < 200.0);
+    return elapsed.count() / static_cast<double>(runs);
+}
+
+static size_t total_bytes(const vector<string>& lines) {
+    size_t bytes = 0;
+    for (const string& l : lines) bytes += l.size();
+    return bytes;
+}
+
+static void width_row(const char* name, const vector<string>& lines) {
+    size_t checksum = 0;
+    for (const string& l : lines) checksum += utf8_display_width(l);
+
+    volatile size_t sink = 0;
+    double ms = time_pass([&] {
+        size_t w = 0;
+        for (const string& l : lines) w += utf8_display_width(l);
+        sink = sink + w;
+        });
+    double mbps = static_cast<double>(total_bytes(lines)) / (ms * 1000.0);
+    printf("  %-8s %5zu lines %8.3f ms %9.1f MB/s   checksum %zu\n", name, lines.size(), ms, mbps, checksum);
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : TEXT_BENCH_ART;
+    ifstream in(path);
+    if (!in) {
+        printf("can't open %s\n", path);
+        return 1;
+    }
+    vector<string> art;
+    for (string line; getline(in, line);) art.push_back(line);
+
+    printf("%s: %zu lines, %zu bytes, width engine: %s\n\n", path, art.size(), total_bytes(art), VARIANT);
+
+    // colors: same work as loading the file into AsciiArt
+    vector<string> colored;
+    for (const string& l : art) colored.push_back(processColorCodes(l));
+
+    volatile size_t sink = 0;
+    double regexMs = time_pass([&] {
+        for (const string& l : art) sink = sink + regexStripAnsi(regexColorCodes(l)).size();
+        });
+    double scanMs = time_pass([&] {
+        for (const string& l : art) sink = sink + stripAnsiSequences(processColorCodes(l)).size();
+        });
+    printf("colors (process + strip)\n");
+    printf("  regex    %8.3f ms\n", regexMs);
+    printf("  scanner  %8.3f ms  (x%.0f)\n\n", scanMs, regexMs / scanMs);
+
+    // width: typical info lines next to the art
+    vector<string> ascii, wide;
+    for (size_t i = 0; i < art.size(); ++i) {
+        ascii.push_back("CPU: AMD Ryzen 9 7950X 16-Core Processor (16 cores, 32 threads) @ 4.50 GHz #" + to_string(i));
+        wide.push_back(u8"ユーザー: 管理者 \U0001F600 ディスク C: 512 GB #" + to_string(i));
+    }
+    printf("utf8_display_width\n");
+    width_row("art", colored);
+    width_row("ascii", ascii);
+    width_row("cjk", wide);
+    return 0;
+}